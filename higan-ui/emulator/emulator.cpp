@@ -4,8 +4,12 @@
 #include "audio.cpp"
 #include "input.cpp"
 #include "states.cpp"
+#include "movies.cpp"
 #include "status.cpp"
 #include "utility.cpp"
+#include "recorder.cpp"
+#include "movie.cpp"
+#include "saves.cpp"
 
 Emulator emulator;
 
@@ -32,8 +36,10 @@ auto Emulator::create(shared_pointer<higan::Interface> instance, string location
 
   screens.reset();
   streams.reset();
+  higan::Memory::Mapping::enabled = settings.emulator.mapImages;
   interface->load(root);
   root->copy(higan::Node::unserialize(configuration));
+  if constexpr(higan::Profiler::enabled) root->append(higan::_profiler.node());
 
   systemMenu.setText(system.name);
   toolsMenu.pauseEmulation.setChecked(false);
@@ -55,6 +61,7 @@ auto Emulator::unload() -> void {
   power(false);
   if(system.log) system.log.close();
 
+  if constexpr(higan::Profiler::enabled) root->remove(higan::_profiler.node());
   if(auto location = root->attribute("location")) {
     file::write({location, "settings.bml"}, higan::Node::serialize(root));
   }
@@ -64,6 +71,7 @@ auto Emulator::unload() -> void {
   root = {};
   interface->unload();
   interface.reset();
+  saves.stop();
 
   program.setTitle({"higan v", higan::Version});
   systemMenu.setText("System");
@@ -86,6 +94,12 @@ auto Emulator::main() -> void {
     usleep(20 * 1000);
   } else {
     interface->run();
+    movie.synchronize();
+    if(settings.emulator.flushInterval && chrono::millisecond() - state.flushed >= settings.emulator.flushInterval * 1000) {
+      state.flushed = chrono::millisecond();
+      interface->save();
+    }
+    if(toolsMenu.playMovie.checked() && !movie.playing()) stopMovie();  //playback reached the end
     if(events.power) power(false);  //system powered itself off
   }
 }
@@ -115,11 +129,15 @@ auto Emulator::power(bool on) -> void {
     audioUpdateEffects();
     events = {};
     interface->power();
+    higan::profile<&higan::Profiler::reset>();
+    state.flushed = chrono::millisecond();
     //powering on the system latches static settings
     nodeManager.refreshSettings();
     if(settingEditor.visible()) settingEditor.refresh();
     program.viewport.setFocused();
   } else {
+    stopRecording();
+    stopMovie();
     program.setTitle(system.name);
     setCaption();
     videoInstance.clear();
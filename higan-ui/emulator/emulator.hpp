@@ -1,3 +1,7 @@
+#include "recorder.hpp"
+#include "movie.hpp"
+#include "saves.hpp"
+
 struct Emulator : higan::Platform {
   higan::Node::Object root;
 
@@ -38,6 +42,12 @@ struct Emulator : higan::Platform {
   auto saveState(uint slot) -> bool;
   auto loadState(uint slot) -> bool;
 
+  //movies.cpp
+  auto recordMovie() -> bool;
+  auto playMovie() -> bool;
+  auto stopMovie() -> void;
+  auto seekMovie() -> bool;
+
   //status.cpp
   auto updateMessage() -> void;
   auto showMessage(const string& message = {}) -> void;
@@ -45,6 +55,9 @@ struct Emulator : higan::Platform {
 
   //utility.cpp
   auto captureScreenshot(const uint32_t* data, uint pitch, uint width, uint height) -> void;
+  auto startRecording() -> bool;
+  auto stopRecording() -> void;
+  auto saveProfile() -> bool;
 
   struct System {
     string name;
@@ -67,10 +80,14 @@ struct Emulator : higan::Platform {
       uint64_t timestamp = 0;
       string text;
     } message;
+    uint64_t flushed = 0;  //time of the last periodic save data flush
   } state;
 
   vector<higan::Node::Screen> screens;
   vector<higan::Node::Stream> streams;
+  Recorder recorder;
+  Movie movie;
+  Saves saves;
 };
 
 extern Emulator emulator;
@@ -0,0 +1,214 @@
+//movie file format (all values little-endian):
+//  header: "HMOV", version (4 bytes), game name size (4 bytes), game name
+//  keyframes: count (4 bytes), then for each: frame (4 bytes), state size (4 bytes), state
+//  inputs: stream size (4 bytes), stream
+
+//starts recording from the current emulator state
+auto Movie::record() -> bool {
+  stop();
+  _game = interface->game();
+  _stream = {};
+  _offsets.reset();
+  _polls.reset();
+  _keyframes.reset();
+  _frame = 0;
+  _desynchronized = false;
+  if(!keyframe()) return false;
+  _mode = Mode::Recording;
+  return true;
+}
+
+auto Movie::play(const string& filename) -> bool {
+  stop();
+  _error = {};
+  auto buffer = file::read(filename);
+  if(buffer.size() < 12 || memory::compare(buffer.data(), "HMOV", 4)) return false;
+
+  uint offset = 4;
+  auto read = [&](uint length) -> uint64_t {
+    uint64_t data = 0;
+    for(uint byte : range(length)) {
+      if(offset < buffer.size()) data |= (uint64_t)buffer[offset] << byte * 8;
+      offset++;
+    }
+    return data;
+  };
+  auto readBlock = [&](uint length) -> vector<uint8_t> {
+    vector<uint8_t> data;
+    length = min(length, buffer.size() - min(offset, buffer.size()));
+    data.resize(length);
+    if(length) memory::copy(data.data(), buffer.data() + offset, length);
+    offset += length;
+    return data;
+  };
+
+  if(read(4) != 1) return false;
+  auto game = readBlock(read(4));
+  _game.resize(game.size());
+  memory::copy(_game.get(), game.data(), game.size());
+  if(_game != interface->game()) {
+    _error = {"Movie was recorded with a different game: ", _game};
+    return false;
+  }
+  _keyframes.reset();
+  for(uint count = read(4); count; count--) {
+    Keyframe keyframe;
+    keyframe.frame = read(4);
+    keyframe.state = readBlock(read(4));
+    _keyframes.append(keyframe);
+  }
+  if(!_keyframes) return false;
+  _stream = {};
+  _stream.data = readBlock(read(4));
+
+  //rebuild the per-frame index by walking the stream
+  _offsets.reset();
+  while(_stream.offset < _stream.data.size()) {
+    _offsets.append(_stream.offset);
+    for(uint polls = _stream.readvu(); polls; polls--) _stream.readvs();
+  }
+
+  _mode = Mode::Playing;
+  _desynchronized = false;
+  if(!seek(0)) return stop(), false;
+  return true;
+}
+
+auto Movie::save(const string& filename) -> bool {
+  if(!_keyframes) return false;
+  file_buffer fp;
+  if(!fp.open(filename, file_buffer::mode::write)) return false;
+  fp.writes("HMOV");
+  fp.writel(1, 4);
+  fp.writel(_game.size(), 4);
+  fp.writes(_game);
+  fp.writel(_keyframes.size(), 4);
+  for(auto& keyframe : _keyframes) {
+    fp.writel(keyframe.frame, 4);
+    fp.writel(keyframe.state.size(), 4);
+    fp.write(keyframe.state);
+  }
+  fp.writel(_stream.data.size(), 4);
+  fp.write(_stream.data);
+  return true;
+}
+
+auto Movie::stop() -> void {
+  _mode = Mode::Inactive;
+  _keyframePending = false;
+  _polls.reset();
+  _remaining = 0;
+}
+
+//restores the nearest keyframe, and then replays inputs with output suppressed up to the requested frame.
+//when recording, the movie is truncated at that frame and recording resumes from there.
+auto Movie::seek(uint frame) -> bool {
+  if(_mode == Mode::Inactive || frame > frames()) return false;
+  if(_mode == Mode::Playing && frame == frames()) return false;
+
+  maybe<Keyframe&> nearest;
+  for(auto& keyframe : _keyframes) {
+    if(keyframe.frame <= frame) nearest = keyframe;
+  }
+  if(!nearest) return false;
+
+  serializer state{nearest->state.data(), (uint)nearest->state.size()};
+  if(!interface->unserialize(state)) return false;
+
+  auto mode = _mode;
+  _mode = Mode::Playing;
+  _keyframePending = false;
+  begin(nearest->frame);
+  higan::setRunAhead(true);
+  while(_frame < frame) {
+    interface->run();
+    synchronize();
+  }
+  higan::setRunAhead(false);
+
+  if(mode == Mode::Recording) {
+    if(_frame < frames()) _stream.data.resize(_offsets[_frame]);
+    _offsets.resize(_frame);
+    while(_keyframes && _keyframes.right().frame > _frame) _keyframes.removeRight();
+    _polls.reset();
+    _remaining = 0;
+  }
+  _mode = mode;
+  return true;
+}
+
+auto Movie::capture(higan::Node::Input input) -> void {
+  if(_mode != Mode::Recording) return;
+  if(auto button = input->cast<higan::Node::Button>()) _polls.append(button->value());
+  if(auto axis = input->cast<higan::Node::Axis>()) _polls.append(axis->value());
+}
+
+auto Movie::replay(higan::Node::Input input) -> void {
+  if(_mode != Mode::Playing) return;
+  int value = 0;
+  if(_remaining) {
+    value = _stream.readvs();
+    _remaining--;
+  } else {
+    //the core polled more inputs this frame than were recorded
+    _desynchronized = true;
+  }
+  if(auto button = input->cast<higan::Node::Button>()) button->setValue(value);
+  if(auto axis = input->cast<higan::Node::Axis>()) axis->setValue(value);
+}
+
+//called on each Event::Frame: commits the polls of the completed frame and advances to the next.
+auto Movie::endFrame() -> void {
+  if(_mode == Mode::Recording) {
+    _offsets.append(_stream.data.size());
+    _stream.writevu(_polls.size());
+    for(auto value : _polls) _stream.writevs(value);
+    _polls.reset();
+  }
+
+  if(_mode == Mode::Playing) {
+    //the core polled fewer inputs this frame than were recorded
+    if(_remaining) _desynchronized = true;
+  }
+
+  if(_mode == Mode::Inactive) return;
+  _frame++;
+  _keyframePending = _frame % KeyframeInterval == 0;
+
+  if(_mode == Mode::Playing) {
+    if(_frame >= frames()) return stop();
+    begin(_frame);
+  }
+}
+
+//called from outside the scheduler after each Interface::run().
+//savestates synchronize all threads, which is only possible between run() calls.
+//playback serializes at the same frames as recording did, so that thread timing matches exactly.
+auto Movie::synchronize() -> void {
+  if(!_keyframePending) return;
+  _keyframePending = false;
+  if(_mode == Mode::Recording) {
+    keyframe();
+  } else if(_mode == Mode::Playing) {
+    interface->serialize();
+  }
+}
+
+auto Movie::begin(uint frame) -> void {
+  _frame = frame;
+  _remaining = 0;
+  if(frame >= frames()) return;
+  _stream.offset = _offsets[frame];
+  _remaining = _stream.readvu();
+}
+
+auto Movie::keyframe() -> bool {
+  auto state = interface->serialize();
+  if(!state) return false;
+  Keyframe keyframe;
+  keyframe.frame = _frame;
+  keyframe.state.resize(state.size());
+  memory::copy(keyframe.state.data(), state.data(), state.size());
+  _keyframes.append(keyframe);
+  return true;
+}
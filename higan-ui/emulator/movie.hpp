@@ -0,0 +1,57 @@
+//deterministic input movies
+//every Node::Input poll is captured in order and grouped by emulated frame:
+//each frame stores its poll count followed by each polled value, as variable-length integers.
+//savestate keyframes are embedded periodically, so that seeking costs at most one keyframe interval of emulation.
+
+struct Movie {
+  enum class Mode : uint { Inactive, Recording, Playing };
+  enum : uint { KeyframeInterval = 600 };  //frames between embedded savestates
+
+  struct Keyframe {
+    uint frame = 0;
+    vector<uint8_t> state;
+  };
+
+  struct Stream : varint {
+    auto read() -> uint8_t override { return offset < data.size() ? data[offset++] : 0; }
+    auto write(uint8_t byte) -> void override { data.append(byte); }
+
+    vector<uint8_t> data;
+    uint offset = 0;
+  };
+
+  auto mode() const -> Mode { return _mode; }
+  auto recording() const -> bool { return _mode == Mode::Recording; }
+  auto playing() const -> bool { return _mode == Mode::Playing; }
+  auto desynchronized() const -> bool { return _desynchronized; }
+  auto frame() const -> uint { return _frame; }
+  auto frames() const -> uint { return _offsets.size(); }
+  auto error() const -> string { return _error; }  //why the last play() failed, if known
+
+  auto record() -> bool;
+  auto play(const string& filename) -> bool;
+  auto save(const string& filename) -> bool;
+  auto stop() -> void;
+  auto seek(uint frame) -> bool;
+
+  auto capture(higan::Node::Input) -> void;
+  auto replay(higan::Node::Input) -> void;
+  auto endFrame() -> void;
+  auto synchronize() -> void;
+
+private:
+  auto begin(uint frame) -> void;
+  auto keyframe() -> bool;
+
+  Mode _mode = Mode::Inactive;
+  string _game;
+  string _error;
+  uint _frame = 0;
+  bool _keyframePending = false;
+  bool _desynchronized = false;
+  Stream _stream;
+  vector<uint> _offsets;      //stream offset of each recorded frame
+  vector<int> _polls;         //values polled during the frame being recorded
+  uint _remaining = 0;        //polls left in the frame being played
+  vector<Keyframe> _keyframes;
+};
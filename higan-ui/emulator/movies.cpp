@@ -0,0 +1,77 @@
+auto Emulator::recordMovie() -> bool {
+  if(!system.power) return false;
+  stopMovie();
+  if(movie.record()) {
+    toolsMenu.recordMovie.setChecked(true);
+    showMessage("Recording movie");
+    return true;
+  }
+  showMessage("Failed to record movie");
+  return false;
+}
+
+auto Emulator::playMovie() -> bool {
+  if(!system.power) return false;
+  if(auto cartridge = root->find<higan::Node::Peripheral>(0)) {
+    if(auto location = cartridge->attribute("location")) {
+      if(auto filename = BrowserDialog()
+      .setTitle("Play Movie")
+      .setPath({location, "Movies/"})
+      .setFilters({"Movies (.bmv)|*.bmv"})
+      .setAlignment(program)
+      .openFile()
+      ) {
+        stopMovie();
+        if(movie.play(filename)) {
+          toolsMenu.playMovie.setChecked(true);
+          showMessage("Playing movie");
+          return true;
+        }
+        if(auto error = movie.error()) return showMessage(error), false;
+      }
+    }
+  }
+  showMessage("Failed to play movie");
+  return false;
+}
+
+auto Emulator::stopMovie() -> void {
+  bool playing = toolsMenu.playMovie.checked();
+  toolsMenu.recordMovie.setChecked(false);
+  toolsMenu.playMovie.setChecked(false);
+
+  if(movie.recording()) {
+    movie.stop();
+    if(auto cartridge = root->find<higan::Node::Peripheral>(0)) {
+      if(auto location = cartridge->attribute("location")) {
+        directory::create({location, "Movies/"});
+        string datetime = chrono::local::datetime().transform(":", "-");
+        if(movie.save({location, "Movies/", datetime, ".bmv"})) return showMessage("Saved movie");
+      }
+    }
+    return showMessage("Failed to save movie");
+  }
+
+  if(playing) {
+    movie.stop();
+    showMessage(movie.desynchronized() ? "Movie playback desynchronized" : "Stopped movie");
+  }
+}
+
+//when recording, seeking back discards everything after the chosen frame and recording resumes from there.
+auto Emulator::seekMovie() -> bool {
+  if(!system.power) return false;
+  if(!movie.recording() && !movie.playing()) return showMessage("No movie is active"), false;
+  uint last = movie.recording() ? movie.frames() : movie.frames() - 1;
+  if(auto value = NameDialog()
+  .setTitle("Seek Movie")
+  .setText({"Frame to seek to (0 - ", last, "):"})
+  .setAlignment(program)
+  .create({movie.frame()})
+  ) {
+    uint frame = value.natural();
+    if(movie.seek(frame)) return showMessage({"Seeked movie to frame ", frame}), true;
+    showMessage("Failed to seek movie");
+  }
+  return false;
+}
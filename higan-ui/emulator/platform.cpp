@@ -17,6 +17,11 @@ auto Emulator::detach(higan::Node::Object node) -> void {
     streams = root->find<higan::Node::Stream>();
   }
 
+  //the mapping is owned by inputManager, and will be released on the next bind()
+  if(auto input = node->cast<higan::Node::Input>()) {
+    input->setUserData(nullptr);
+  }
+
   if(auto location = node->attribute("location")) {
     file::write({location, "settings.bml"}, node->save());
   }
@@ -33,6 +38,13 @@ auto Emulator::open(higan::Node::Object node, string name, vfs::file::mode mode,
     }
   }
 
+  //save data is persisted asynchronously; it must be on disk before it can be read back
+  if(mode == vfs::file::mode::write) return saves.open({location, name});
+  saves.synchronize();
+  //CD images are compressed by icarus; uncompressed images from earlier imports are opened as-is below
+  if(name == "cd.rom" && mode == vfs::file::mode::read) {
+    if(auto result = vfs::cdz::open({location, name})) return result;
+  }
   if(auto result = vfs::disk::open({location, name}, mode)) return result;
 
   if(required) {
@@ -71,6 +83,10 @@ auto Emulator::open(higan::Node::Object node, string name, vfs::file::mode mode,
 }
 
 auto Emulator::event(higan::Event event) -> void {
+  if(event == higan::Event::Frame) {
+    movie.endFrame();
+  }
+
   if(event == higan::Event::Power) {
     events.power = true;
   }
@@ -91,6 +107,8 @@ auto Emulator::video(higan::Node::Screen node, const uint32_t* data, uint pitch,
     captureScreenshot(data, pitch, width, height);
   }
 
+  recorder.video(data, pitch, width, height);
+
   uint videoWidth = node->width() * node->scaleX();
   uint videoHeight = node->height() * node->scaleY();
 
@@ -173,6 +191,8 @@ auto Emulator::audio(higan::Node::Stream) -> void {
       }
     }
 
+    recorder.audio(samples[0], samples[1]);
+
     //apply volume, balance, and clamping to the output frame
     double volume = !settings.audio.mute ? settings.audio.volume : 0.0;
     double balance = settings.audio.balance;
@@ -188,7 +208,7 @@ auto Emulator::audio(higan::Node::Stream) -> void {
 }
 
 auto Emulator::input(higan::Node::Input input) -> void {
-  inputManager.poll();
+  if(movie.playing()) return movie.replay(input);
 
   bool allow = program.viewport.focused();
   if(settings.input.unfocused == "Allow") allow = true;
@@ -196,15 +216,17 @@ auto Emulator::input(higan::Node::Input input) -> void {
 
   if(auto button = input->cast<higan::Node::Button>()) {
     button->setValue(0);
-    if(auto instance = button->attribute<shared_pointer<InputButton>>("instance")) {
+    if(auto instance = button->userData<InputButton>()) {
       if(allow) button->setValue(instance->value());
     }
   }
 
   if(auto axis = input->cast<higan::Node::Axis>()) {
     axis->setValue(0);
-    if(auto instance = axis->attribute<shared_pointer<InputAxis>>("instance")) {
+    if(auto instance = axis->userData<InputAxis>()) {
       if(allow) axis->setValue(instance->value());
     }
   }
+
+  movie.capture(input);
 }
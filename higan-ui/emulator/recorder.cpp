@@ -0,0 +1,170 @@
+#include <nall/encode/huffman.hpp>
+#include <nall/encode/rle.hpp>
+
+//recording file format (all values little-endian):
+//  header: "HAVR", version (4 bytes), audio frequency (4 bytes)
+//  chunk: sequence (4 bytes), width (2 bytes), height (2 bytes), keyframe (1 byte),
+//         video size (4 bytes), video data, audio sample count (4 bytes), audio samples (2 bytes * 2 channels)
+//video data is Huffman(RLE<4>(residual)), where the residual of each pixel is:
+//  keyframe: pixel XOR the pixel to its left (the first pixel of each row is stored as-is)
+//  otherwise: pixel XOR the same pixel of the previous frame
+//a chunk with a width of zero carries only audio.
+
+auto Recorder::start(const string& filename, uint frequency) -> bool {
+  stop();
+  if(!fp.open(filename, file_buffer::mode::write)) return false;
+  fp.writes("HAVR");
+  fp.writel(1, 4);
+  fp.writel(frequency, 4);
+
+  sequence = 0;
+  written = 0;
+  width = 0;
+  height = 0;
+  reference.reset();
+  samples.reset();
+  queue.reset();
+  completed.reset();
+
+  pending = 0;
+  running = true;
+  for(uint n : range(Workers)) {
+    workers.append(nall::thread::create([&](uintptr) { worker(); }));
+  }
+  return recording = true;
+}
+
+auto Recorder::stop() -> void {
+  if(!recording) return;
+  recording = false;
+
+  //flush any audio that was mixed after the last frame
+  if(samples) {
+    auto frame = shared_pointer_make<Frame>();
+    frame->samples = move(samples);
+    enqueue(move(frame));
+  }
+
+  {
+    std::unique_lock<std::mutex> guard(lock);
+    drained.wait(guard, [&] { return pending == 0; });
+    running = false;
+  }
+  wake.notify_all();
+  for(auto& thread : workers) thread.join();
+  workers.reset();
+
+  reference.reset();
+  fp.close();
+}
+
+auto Recorder::video(const uint32_t* data, uint pitch, uint width, uint height) -> void {
+  if(!recording) return;
+
+  auto frame = shared_pointer_make<Frame>();
+  frame->width = width;
+  frame->height = height;
+  frame->keyframe = width != this->width || height != this->height || sequence % KeyframeInterval == 0;
+  frame->pixels.resize(width * height);
+  frame->samples = move(samples);
+  if(frame->keyframe) reference.resize(width * height);
+  this->width = width;
+  this->height = height;
+
+  pitch >>= 2;
+  for(uint y : range(height)) {
+    auto source = data + y * pitch;
+    auto target = frame->pixels.data() + y * width;
+    auto previous = reference.data() + y * width;
+    if(frame->keyframe) {
+      memory::copy<uint32_t>(target, source, width);
+      memory::copy<uint32_t>(previous, source, width);
+    } else {
+      for(uint x : range(width)) {
+        uint32_t pixel = source[x];
+        target[x] = pixel ^ previous[x];
+        previous[x] = pixel;
+      }
+    }
+  }
+
+  enqueue(move(frame));
+}
+
+auto Recorder::audio(double left, double right) -> void {
+  if(!recording) return;
+  samples.append(sclamp<16>(left  * 32767.0));
+  samples.append(sclamp<16>(right * 32767.0));
+}
+
+auto Recorder::enqueue(shared_pointer<Frame>&& frame) -> void {
+  //encoding is lossless: if the workers fall too far behind, wait rather than drop frames
+  std::unique_lock<std::mutex> guard(lock);
+  drained.wait(guard, [&] { return pending < QueueLimit; });
+  frame->sequence = sequence++;
+  pending++;
+  queue.append(move(frame));
+  wake.notify_one();
+}
+
+auto Recorder::worker() -> void {
+  std::unique_lock<std::mutex> guard(lock);
+  while(true) {
+    wake.wait(guard, [&] { return queue || !running; });
+    if(!queue) break;
+    auto frame = queue.takeFirst();
+    guard.unlock();
+
+    encode(*frame);
+    writeLock.lock();
+    completed.append(move(frame));
+    uint frames = write();
+    writeLock.unlock();
+
+    guard.lock();
+    if(frames) {
+      pending -= frames;
+      drained.notify_all();
+    }
+  }
+}
+
+auto Recorder::encode(Frame& frame) -> void {
+  if(!frame.width || !frame.height) return;
+
+  //delta frames already hold their residual; keyframes are decorrelated against the pixel to their left
+  if(frame.keyframe) {
+    for(uint y : range(frame.height)) {
+      auto line = frame.pixels.data() + y * frame.width;
+      for(uint x : reverse(range(1, frame.width))) line[x] ^= line[x - 1];
+    }
+  }
+
+  frame.encoded = Encode::Huffman(Encode::RLE<4>({(const uint8_t*)frame.pixels.data(), frame.pixels.size() * sizeof(uint32_t)}));
+  frame.pixels.reset();
+}
+
+//writes completed frames in sequence order, and returns how many were written; must be called with writeLock held
+auto Recorder::write() -> uint {
+  uint frames = 0;
+  while(true) {
+    maybe<uint> index;
+    for(uint n : range(completed.size())) {
+      if(completed[n]->sequence == written) { index = n; break; }
+    }
+    if(!index) return frames;
+
+    auto frame = completed.take(*index);
+    fp.writel(frame->sequence, 4);
+    fp.writel(frame->width, 2);
+    fp.writel(frame->height, 2);
+    fp.writel(frame->keyframe, 1);
+    fp.writel(frame->encoded.size(), 4);
+    fp.write(frame->encoded);
+    fp.writel(frame->samples.size() / 2, 4);
+    for(auto sample : frame->samples) fp.writel((uint16_t)sample, 2);
+
+    written++;
+    frames++;
+  }
+}
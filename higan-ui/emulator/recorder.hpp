@@ -0,0 +1,57 @@
+//lossless audio/video recorder
+//the emulation thread only copies each frame into a new buffer (computing the inter-frame delta as it copies)
+//and queues it; a small pool of worker threads performs all entropy coding and file output.
+//frames are handed between threads by move, as shared_pointer reference counts are not atomic.
+
+struct Recorder {
+  enum : uint { Workers = 3 };             //encoding threads
+  enum : uint { KeyframeInterval = 60 };   //frames between intra-coded frames
+  enum : uint { QueueLimit = 120 };        //frames that may be pending before capture waits on encoding
+
+  struct Frame {
+    uint sequence = 0;
+    uint width = 0;
+    uint height = 0;
+    bool keyframe = false;
+    vector<uint32_t> pixels;
+    vector<int16_t> samples;  //stereo audio mixed since the previous frame
+    vector<uint8_t> encoded;
+  };
+
+  ~Recorder() { stop(); }
+
+  explicit operator bool() const { return recording; }
+
+  auto start(const string& filename, uint frequency) -> bool;
+  auto stop() -> void;
+
+  auto video(const uint32_t* data, uint pitch, uint width, uint height) -> void;
+  auto audio(double left, double right) -> void;
+
+private:
+  auto enqueue(shared_pointer<Frame>&& frame) -> void;
+  auto worker() -> void;
+  auto encode(Frame& frame) -> void;
+  auto write() -> uint;
+
+  bool recording = false;
+  file_buffer fp;
+  uint sequence = 0;
+  uint written = 0;
+  uint width = 0;
+  uint height = 0;
+  vector<uint32_t> reference;  //the previous frame, used to compute delta frames
+  vector<int16_t> samples;
+
+  //guards running, pending and queue
+  std::mutex lock;
+  std::condition_variable wake;     //signaled when a frame is queued, or when the workers are stopped
+  std::condition_variable drained;  //signaled when frames have been written
+  bool running = false;
+  uint pending = 0;  //frames queued but not yet written
+  vector<shared_pointer<Frame>> queue;
+
+  std::mutex writeLock;  //guards completed, written and fp once recording has started
+  vector<shared_pointer<Frame>> completed;
+  vector<nall::thread> workers;
+};
@@ -0,0 +1,65 @@
+auto Saves::open(const string& location) -> shared_pointer<vfs::file> {
+  return shared_pointer<vfs::file>{new File(*this, location)};
+}
+
+//waits until all released files have been written
+auto Saves::synchronize() -> void {
+  std::unique_lock<std::mutex> guard(lock);
+  idle.wait(guard, [&] { return pending == 0; });
+}
+
+auto Saves::stop() -> void {
+  {
+    std::unique_lock<std::mutex> guard(lock);
+    if(!running) return;
+    idle.wait(guard, [&] { return pending == 0; });
+    running = false;
+  }
+  wake.notify_one();
+  thread.join();
+  written.reset();
+}
+
+auto Saves::commit(string&& location, vector<uint8_t>&& data) -> void {
+  std::lock_guard<std::mutex> guard(lock);
+  if(!running) {
+    running = true;
+    thread = nall::thread::create([&](uintptr) { worker(); });
+  }
+  pending++;
+  queue.append({move(location), move(data)});
+  wake.notify_one();
+}
+
+auto Saves::worker() -> void {
+  std::unique_lock<std::mutex> guard(lock);
+  while(true) {
+    wake.wait(guard, [&] { return queue || !running; });
+    if(!queue) break;
+    auto save = queue.takeFirst();
+    guard.unlock();
+
+    //the first write of each file is compared against what is already on disk
+    if(!written.find(save.location)) written.insert(save.location, file::read(save.location));
+    auto& previous = written.find(save.location)();
+    if(previous.size() != save.data.size() || memory::compare(previous.data(), save.data.data(), save.data.size())) {
+      if(write(save)) previous = save.data;
+    }
+
+    guard.lock();
+    if(--pending == 0) idle.notify_all();
+  }
+}
+
+auto Saves::write(const Pending& save) -> bool {
+  string temporary{save.location, ".tmp"};
+  if(auto fp = file::open(temporary, file::mode::write)) {
+    fp.write(save.data);
+    if(fp.sync()) {
+      fp.close();
+      if(file::replace(temporary, save.location)) return true;
+    }
+  }
+  file::remove(temporary);
+  return false;
+}
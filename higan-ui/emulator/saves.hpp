@@ -0,0 +1,69 @@
+//crash-safe save data persistence
+//cores write their save data (battery-backed RAM, RTC state, etc) through Emulator::open() in write mode.
+//each such file is captured in memory, and handed to a worker thread once the core releases it.
+//the worker skips files whose contents are unchanged since they were last written; changed files are written
+//to a temporary file, synced to disk, and then renamed over the original, so that a crash at any point
+//leaves either the previous or the new save intact. this makes periodic flushes cheap when nothing has changed.
+
+struct Saves {
+  struct File : vfs::file {
+    File(Saves& saves, const string& location) : saves(saves), location(location) {}
+    ~File() { saves.commit(move(location), move(data)); }
+
+    auto size() const -> uintmax override { return data.size(); }
+    auto offset() const -> uintmax override { return position; }
+
+    auto seek(intmax offset, index mode) -> void override {
+      if(mode == index::absolute) position = offset;
+      if(mode == index::relative) position += offset;
+    }
+
+    auto read() -> uint8_t override {
+      return position < data.size() ? data[position++] : 0x00;
+    }
+
+    auto write(uint8_t byte) -> void override {
+      if(position >= data.size()) data.resize(position + 1);
+      data[position++] = byte;
+    }
+
+    using vfs::file::write;
+    auto write(const void* source, uintmax bytes) -> void override {
+      if(position + bytes > data.size()) data.resize(position + bytes);
+      memory::copy(data.data() + position, source, bytes);
+      position += bytes;
+    }
+
+  private:
+    Saves& saves;
+    string location;
+    vector<uint8_t> data;
+    uintmax position = 0;
+  };
+
+  ~Saves() { stop(); }
+
+  auto open(const string& location) -> shared_pointer<vfs::file>;
+  auto synchronize() -> void;
+  auto stop() -> void;
+
+private:
+  struct Pending {
+    string location;
+    vector<uint8_t> data;
+  };
+
+  auto commit(string&& location, vector<uint8_t>&& data) -> void;
+  auto worker() -> void;
+  auto write(const Pending& save) -> bool;
+
+  //guards running, pending and queue
+  std::mutex lock;
+  std::condition_variable wake;  //signaled when a file is queued, or when the worker is stopped
+  std::condition_variable idle;  //signaled when every queued file has been written
+  bool running = false;
+  uint pending = 0;
+  vector<Pending> queue;
+  nall::thread thread;
+  map<string, vector<uint8_t>> written;  //contents of each file as it was last written; only used by the worker
+};
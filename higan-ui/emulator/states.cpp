@@ -22,6 +22,7 @@ auto Emulator::loadState(uint slot) -> bool {
       if(auto memory = file::read({location, "State/Slot ", slot, ".bst"})) {
         serializer state{memory.data(), (uint)memory.size()};
         if(interface->unserialize(state)) {
+          stopMovie();  //the movie input stream no longer matches the emulator state
           showMessage({"Loaded state ", slot});
           return true;
         }
@@ -5,3 +5,35 @@ auto Emulator::captureScreenshot(const uint32_t* data, uint pitch, uint width, u
   Encode::PNG::RGB8(filename, data, pitch, width, height);
   showMessage("Captured screenshot");
 }
+
+auto Emulator::startRecording() -> bool {
+  if(!system.power) return false;
+  string filename{Path::desktop(), "higan ", chrono::local::datetime().transform(":", "-"), ".hav"};
+  if(!recorder.start(filename, settings.audio.frequency)) {
+    showMessage("Failed to start recording");
+    return false;
+  }
+  toolsMenu.recordAudioVideo.setChecked(true);
+  showMessage("Started recording");
+  return true;
+}
+
+auto Emulator::stopRecording() -> void {
+  toolsMenu.recordAudioVideo.setChecked(false);
+  if(!recorder) return;
+  recorder.stop();
+  showMessage("Stopped recording");
+}
+
+//writes the profiler counters collected since power on, in both CSV and JSON formats
+auto Emulator::saveProfile() -> bool {
+  if(!system.power) return false;
+  string filename{Path::desktop(), "higan ", chrono::local::datetime().transform(":", "-")};
+  if(!file::write({filename, ".csv"}, higan::_profiler.csv())
+  || !file::write({filename, ".json"}, higan::_profiler.json())) {
+    showMessage("Failed to save profile");
+    return false;
+  }
+  showMessage("Saved profile");
+  return true;
+}
@@ -150,6 +150,7 @@ auto nall::main(Arguments arguments) -> void {
   #endif
 
   higan::platform = &emulator;
+  if constexpr(higan::Profiler::enabled) higan::platform = higan::_profiler.platform(&emulator);
 
   Instances::program.construct();
   emulator.inputUpdate();
@@ -9,6 +9,10 @@ extern shared_pointer<higan::Interface> interface;
 extern vector<shared_pointer<higan::Interface>> interfaces;
 
 #include <nall/instance.hpp>
+#include <nall/map.hpp>
+#include <nall/thread.hpp>
+
+#include <condition_variable>
 
 namespace nall::Path {
   extern string settings;   // ~/.local/share/higan/
@@ -1,6 +1,11 @@
 InputHotkey::InputHotkey(string_view name) : name(name) {
 }
 
+auto InputHotkey::sample() -> int16_t {
+  if(!device) return 0;
+  return device->group(groupID).input(inputID).value();
+}
+
 auto InputHotkey::poll() -> void {
   //don't allow hotkeys to trigger while emulator is unfocused
   if(!videoInstance.fullScreen()) {
@@ -13,7 +18,7 @@ auto InputHotkey::poll() -> void {
   if(hotkeySettings.visible()) return;
 
   if(device && !hotkeySettings.visible()) {
-    newValue = device->group(groupID).input(inputID).value();
+    newValue = inputManager.snapshot().values[index];
     if(oldValue == 0 && newValue == 1 && onPress) onPress();
     if(oldValue == 1 && newValue == 0 && onRelease) onRelease();
     oldValue = newValue;
@@ -63,12 +68,17 @@ Hotkeys::Hotkeys() {
     videoInstance.setBlocking(false);
     audioInstance.setBlocking(false);
     audioInstance.setDynamic(false);
+    //only output every tenth frame, and skip audio processing entirely, so that speed is bound by emulation alone
+    for(auto& screen : emulator.screens) screen->setFrameSkip(9);
+    for(auto& stream : emulator.streams) stream->setFastForward(true);
   };
   fastForward.onRelease = [&] {
     if(!interface) return;
     videoInstance.setBlocking(fastForwardVideoBlocking);
     audioInstance.setBlocking(fastForwardAudioBlocking);
     audioInstance.setDynamic(fastForwardAudioDynamic);
+    for(auto& screen : emulator.screens) screen->setFrameSkip(0);
+    for(auto& stream : emulator.streams) stream->setFastForward(false);
   };
   hotkeys.append(&fastForward);
 
@@ -110,6 +120,8 @@ Hotkeys::Hotkeys() {
     emulator.quit();
   };
   hotkeys.append(&quitEmulator);
+
+  for(uint index : range(hotkeys.size())) hotkeys[index]->index = index;
 }
 
 auto Hotkeys::poll() -> void {
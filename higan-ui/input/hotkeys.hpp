@@ -1,5 +1,6 @@
 struct InputHotkey {
   InputHotkey(string_view name);
+  auto sample() -> int16_t;
   auto poll() -> void;
 
   const string name;
@@ -12,6 +13,7 @@ struct InputHotkey {
   uint groupID = 0;
   uint inputID = 0;
 
+  uint index = 0;  //position in the input snapshot
   bool oldValue = 0;
   bool newValue = 0;
 
@@ -4,7 +4,7 @@
 InputManager inputManager;
 Hotkeys& hotkeys = inputManager.hotkeys;
 
-auto InputButton::value() -> int16_t {
+auto InputButton::sample() -> int16_t {
   auto value = device->group(groupID).input(inputID).value();
 
   if(device->isKeyboard() && groupID == HID::Keyboard::Button) {
@@ -24,9 +24,13 @@ auto InputButton::value() -> int16_t {
   return 0;
 }
 
+auto InputButton::value() const -> int16_t {
+  return inputManager.snapshot().values[index];
+}
+
 //
 
-auto InputAxis::value() -> int16_t {
+auto InputAxis::sample() -> int16_t {
   if(!inputInstance.acquired()) return 0;
   auto value = device->group(groupID).input(inputID).value();
 
@@ -37,15 +41,21 @@ auto InputAxis::value() -> int16_t {
   return 0;
 }
 
+auto InputAxis::value() const -> int16_t {
+  return inputManager.snapshot().values[index];
+}
+
 //
 
 auto InputManager::bind(maybe<higan::Node::Object> newRoot) -> void {
   if(newRoot) root = newRoot();
   if(!root) return;
 
+  buttons.reset();
+  axes.reset();
+  uint index = hotkeys.hotkeys.size();
   for(auto& input : root->find<higan::Node::Input>()) {
-    //not strictly necessary; but release any shared_pointer instances to free up the allocated memory
-    input->setAttribute<shared_pointer<InputButton>>("instance");
+    input->setUserData(nullptr);
 
     auto _pathID = input->attribute("pathID"); if(!_pathID) continue;
     auto _vendorID = input->attribute("vendorID"); if(!_vendorID) continue;
@@ -67,7 +77,9 @@ auto InputManager::bind(maybe<higan::Node::Object> newRoot) -> void {
         instance->inputID = input->attribute("inputID").natural();
         if(input->attribute("qualifier") == "Lo") instance->qualifier = InputButton::Qualifier::Lo;
         if(input->attribute("qualifier") == "Hi") instance->qualifier = InputButton::Qualifier::Hi;
-        input->setAttribute<shared_pointer<InputButton>>("instance", instance);
+        instance->index = index++;
+        input->setUserData(instance.data());
+        buttons.append(instance);
         break;
       }
 
@@ -76,11 +88,14 @@ auto InputManager::bind(maybe<higan::Node::Object> newRoot) -> void {
         instance->device = device;
         instance->groupID = input->attribute("groupID").natural();
         instance->inputID = input->attribute("inputID").natural();
-        input->setAttribute<shared_pointer<InputAxis>>("instance", instance);
+        instance->index = index++;
+        input->setUserData(instance.data());
+        axes.append(instance);
         break;
       }
     }
   }
+  resize();
 }
 
 auto InputManager::unbind() -> void {
@@ -107,9 +122,22 @@ auto InputManager::poll() -> void {
     this->devices = devices;
     bind();
   }
+
+  resize();
+  for(uint index : range(hotkeys.hotkeys.size())) _snapshot.values[index] = hotkeys.hotkeys[index]->sample();
+  for(auto& button : buttons) _snapshot.values[button->index] = button->sample();
+  for(auto& axis : axes) _snapshot.values[axis->index] = axis->sample();
+  _snapshot.timestamp = chrono::microsecond();
 }
 
 auto InputManager::eventInput(shared_pointer<HID::Device> device, uint group, uint input, int16_t oldValue, int16_t newValue) -> void {
   inputMapper.eventInput(device, group, input, oldValue, newValue);
   hotkeySettings.eventInput(device, group, input, oldValue, newValue);
 }
+
+auto InputManager::resize() -> void {
+  uint count = hotkeys.hotkeys.size() + buttons.size() + axes.size();
+  if(_snapshot.values.size() == count) return;
+  _snapshot.values.reset();
+  _snapshot.values.resize(count);
+}
@@ -1,37 +1,58 @@
 #include "hotkeys.hpp"
 
 struct InputAxis {
-  auto value() -> int16_t;
+  auto sample() -> int16_t;
+  auto value() const -> int16_t;
 
   const string name;
   shared_pointer<HID::Device> device;
   uint groupID;
   uint inputID;
+  uint index = 0;  //position in the input snapshot
 };
 
 struct InputButton {
-  auto value() -> int16_t;
+  auto sample() -> int16_t;
+  auto value() const -> int16_t;
 
   const string name;
   shared_pointer<HID::Device> device;
   uint groupID;
   uint inputID;
+  uint index = 0;  //position in the input snapshot
   enum class Qualifier : uint { None, Lo, Hi } qualifier = Qualifier::None;
 };
 
+//the input driver is polled from the main thread, which owns its display connection, once per pass of the main loop.
+//each poll publishes the value of every hotkey and mapped input into a snapshot: reading an input during emulation
+//is then only a load from the snapshot, and device rescans and input events are handled off of that path.
 struct InputManager {
+  struct Snapshot {
+    uint64_t timestamp = 0;  //host time (in microseconds) when the inputs were sampled
+    vector<int16_t> values;  //hotkeys, then buttons and axes
+  };
+
   auto bind(maybe<higan::Node::Object> root = {}) -> void;
   auto unbind() -> void;
 
   auto poll() -> void;
   auto eventInput(shared_pointer<HID::Device>, uint group, uint input, int16_t oldValue, int16_t newValue) -> void;
 
+  auto snapshot() const -> const Snapshot& { return _snapshot; }
+
   higan::Node::Object root;
   vector<shared_pointer<HID::Device>> devices;
+  vector<shared_pointer<InputButton>> buttons;  //mappings referenced by Node::Input::userData()
+  vector<shared_pointer<InputAxis>> axes;
   Hotkeys hotkeys;
 
-  uint64_t pollFrequency = 5;
+  uint64_t pollFrequency = 2;  //minimum milliseconds between samples
   uint64_t lastPoll = 0;
+
+private:
+  auto resize() -> void;
+
+  Snapshot _snapshot;
 };
 
 extern InputManager inputManager;
@@ -52,7 +52,13 @@ struct ToolsMenu : Menu {
     MenuItem loadState4{&loadStateMenu};
     MenuItem loadState5{&loadStateMenu};
   MenuSeparator stateSeparator{this};
+  MenuCheckItem recordMovie{this};
+  MenuCheckItem playMovie{this};
+  MenuItem seekMovie{this};
+  MenuSeparator movieSeparator{this};
   MenuItem captureScreenshot{this};
+  MenuCheckItem recordAudioVideo{this};
+  MenuItem saveProfile{this};
   MenuCheckItem pauseEmulation{this};
 };
 
@@ -14,9 +14,41 @@ ToolsMenu::ToolsMenu(MenuBar* parent) : Menu(parent) {
   loadState4.setText("Slot 4").onActivate([&] { emulator.loadState(4); });
   loadState5.setText("Slot 5").onActivate([&] { emulator.loadState(5); });
 
+  recordMovie.setText("Record Movie").onToggle([&] {
+    if(recordMovie.checked()) {
+      if(!emulator.recordMovie()) recordMovie.setChecked(false);
+    } else {
+      emulator.stopMovie();
+    }
+  });
+
+  playMovie.setText("Play Movie").onToggle([&] {
+    if(playMovie.checked()) {
+      if(!emulator.playMovie()) playMovie.setChecked(false);
+    } else {
+      emulator.stopMovie();
+    }
+  });
+
+  seekMovie.setText("Seek Movie ...").onActivate([&] {
+    emulator.seekMovie();
+  });
+
   captureScreenshot.setIcon(Icon::Emblem::Image).setText("Capture Screenshot").onActivate([&] {
     emulator.requests.captureScreenshot = true;
   });
 
+  recordAudioVideo.setText("Record Audio and Video").onToggle([&] {
+    if(recordAudioVideo.checked()) {
+      if(!emulator.startRecording()) recordAudioVideo.setChecked(false);
+    } else {
+      emulator.stopRecording();
+    }
+  });
+
+  saveProfile.setText("Save Profile").setVisible(higan::Profiler::enabled).onActivate([&] {
+    emulator.saveProfile();
+  });
+
   pauseEmulation.setText("Pause Emulation");
 }
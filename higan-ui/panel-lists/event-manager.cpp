@@ -1,6 +1,7 @@
 EventManager::EventManager(View* view) : PanelList(view, Size{~0, ~0}) {
   setCollapsible().setVisible(false);
   listView.onChange([&] { onChange(); });
+  listView.onData([&](auto item) { onData(item); });
   listView.onToggle([&](auto item) { onToggle(item); });
 }
 
@@ -15,20 +16,15 @@ auto EventManager::hide() -> void {
 }
 
 auto EventManager::refresh() -> void {
-  listView.reset();
+  tracers.reset();
   if(auto root = emulator.root) {
     for(auto& node : *root) refresh(node);
   }
+  listView.setItemCount(tracers.size()).updateItems();
 }
 
 auto EventManager::refresh(higan::Node::Object node) -> void {
-  if(auto tracer = node->cast<higan::Node::Tracer>()) {
-    ListViewItem item{&listView};
-    item.setAttribute<higan::Node::Tracer>("tracer", tracer);
-    item.setCheckable();
-    item.setChecked(tracer->enabled());
-    item.setText({tracer->component(), " ", tracer->name()});
-  }
+  if(auto tracer = node->cast<higan::Node::Tracer>()) tracers.append(tracer);
 
   for(auto& node : *node) refresh(node);
 }
@@ -36,8 +32,16 @@ auto EventManager::refresh(higan::Node::Object node) -> void {
 auto EventManager::onChange() -> void {
 }
 
+auto EventManager::onData(ListViewItem item) -> void {
+  if(auto tracer = tracers(item.offset(), {})) {
+    item.setCheckable();
+    item.setChecked(tracer->enabled());
+    item.setText({tracer->component(), " ", tracer->name()});
+  }
+}
+
 auto EventManager::onToggle(ListViewItem item) -> void {
-  if(auto tracer = item.attribute<higan::Node::Tracer>("tracer")) {
+  if(auto tracer = tracers(item.offset(), {})) {
     tracer->setEnabled(item.checked());
   }
 }
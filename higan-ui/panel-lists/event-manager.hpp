@@ -6,7 +6,9 @@ struct EventManager : PanelList {
   auto refresh(higan::Node::Object node) -> void;
 
   auto onChange() -> void;
+  auto onData(ListViewItem) -> void;
   auto onToggle(ListViewItem) -> void;
 
+  vector<higan::Node::Tracer> tracers;
   ListView listView{this, Size{~0, ~0}};
 };
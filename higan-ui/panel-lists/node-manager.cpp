@@ -1,6 +1,10 @@
 NodeManager::NodeManager(View* view) : PanelList(view, Size{~0, ~0}) {
   setCollapsible().setVisible(false);
   listView.onChange([&] { onChange(); });
+  listView.onData([&](auto item) {
+    auto entry = nodes(item.offset(), {});
+    if(entry.node) item.setText(name(entry.node, entry.depth));
+  });
 }
 
 auto NodeManager::show() -> void {
@@ -20,16 +24,18 @@ auto NodeManager::refresh() -> void {
   //save the currently selected node to try and reselect it after rebuilding the tree
   higan::Node::Object selected;
   if(auto item = listView.selected()) {
-    selected = item.attribute<higan::Node::Object>("node");
+    selected = nodes(item.offset(), {}).node;
   }
 
-  listView.reset();
+  listView.selectNone();
+  nodes.reset();
   if(root) for(auto& node : *root) refresh(node, 0);
+  listView.setItemCount(nodes.size()).updateItems();
 
   //try and restore the previously selected node
-  for(auto& item : listView.items()) {
-    if(item.attribute<higan::Node::Object>("node") == selected) {
-      item.setSelected().setFocused();
+  for(uint offset : range(nodes.size())) {
+    if(nodes[offset].node == selected) {
+      listView.item(offset).setSelected().setFocused();
     }
   }
 }
@@ -41,22 +47,15 @@ auto NodeManager::refresh(higan::Node::Object node, uint depth) -> void {
   if(node->is<higan::Node::Input>()) return;
   if(node->is<higan::Node::Sprite>()) return;
 
-  ListViewItem item{&listView};
-  item.setAttribute<higan::Node::Object>("node", node);
-  item.setAttribute<uint>("depth", depth);
-  item.setText(name(node, depth));
+  nodes.append({node, depth});
 
   for(auto& node : *node) refresh(node, depth + 1);
 }
 
 //refresh the tree after settings have changed
 auto NodeManager::refreshSettings() -> void {
-  for(auto& item : listView.items()) {
-    auto node = item.attribute<higan::Node::Object>("node");
-    if(auto setting = node->cast<higan::Node::Setting>()) {
-      uint depth = item.attribute<uint>("depth");
-      item.setText(name(node, depth));
-    }
+  for(uint offset : range(nodes.size())) {
+    if(nodes[offset].node->is<higan::Node::Setting>()) listView.updateItem(offset);
   }
 }
 
@@ -76,7 +75,9 @@ auto NodeManager::name(higan::Node::Object node, uint depth) -> string {
 }
 
 auto NodeManager::onChange() -> void {
-  if(auto node = listView.selected().attribute<higan::Node::Object>("node")) {
+  higan::Node::Object node;
+  if(auto item = listView.selected()) node = nodes(item.offset(), {}).node;
+  if(node) {
     if(auto port = node->cast<higan::Node::Port>()) {
       portConnector.refresh(port);
       return program.setPanelItem(portConnector);
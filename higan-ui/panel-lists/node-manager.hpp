@@ -8,6 +8,12 @@ struct NodeManager : PanelList {
   auto name(higan::Node::Object node, uint depth) -> string;
   auto onChange() -> void;
 
+  struct Entry {
+    higan::Node::Object node;
+    uint depth = 0;
+  };
+
   higan::Node::Object root;
+  vector<Entry> nodes;  //the visible nodes, in the order they are listed
   ListView listView{this, Size{~0, ~0}};
 };
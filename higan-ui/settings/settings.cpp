@@ -48,6 +48,8 @@ auto Settings::properties(bool mode, Markup::Node document) -> void {
   s(audio.mute)
   s(input.driver)
   s(input.unfocused)
+  s(emulator.flushInterval)
+  s(emulator.mapImages)
   s(interface.showStatusBar)
   s(interface.showSystemPanels)
   s(interface.advancedMode)
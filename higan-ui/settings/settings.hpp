@@ -38,6 +38,11 @@ struct Settings {
     string unfocused = "Block";
   } input;
 
+  struct {
+    uint flushInterval = 60;  //seconds between periodic save data flushes; 0 = only when unloading
+    bool mapImages = false;   //map ROM images from their files rather than copying them; the files must not be modified while in use
+  } emulator;
+
   struct {
     bool showStatusBar = true;
     bool showSystemPanels = true;
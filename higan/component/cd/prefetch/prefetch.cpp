@@ -0,0 +1,92 @@
+#include <higan/higan.hpp>
+#include "prefetch.hpp"
+
+namespace higan {
+
+auto CDPrefetch::load(Shared::File file, uint leadIn) -> void {
+  unload();
+  if(!file) return;
+  this->file = file;
+  this->leadIn = leadIn;
+  sectors = file->size() / SectorSize;
+  currentLBA = Empty;
+  position = -(int)leadIn;
+  for(auto& slot : slots) slot.lba = Empty;
+
+  running = true;
+  thread = nall::thread::create([&](uintptr) { worker(); });
+}
+
+auto CDPrefetch::unload() -> void {
+  {
+    std::lock_guard<std::mutex> guard(lock);
+    if(!running) return;
+    running = false;
+  }
+  wake.notify_one();
+  thread.join();
+  file.reset();
+}
+
+//begins reading ahead from the given sector, without waiting
+auto CDPrefetch::seek(int lba) -> void {
+  {
+    std::lock_guard<std::mutex> guard(lock);
+    position = lba;
+  }
+  wake.notify_one();
+}
+
+//the returned sector remains valid until the next call
+auto CDPrefetch::read(int lba) -> const uint8_t* {
+  if(currentLBA == lba) return current;
+  std::unique_lock<std::mutex> guard(lock);
+  if(!running) {
+    memory::fill(current, SectorSize);
+    return current;
+  }
+  if(position != lba) {
+    position = lba;
+    wake.notify_one();
+  }
+  auto& slot = this->slot(lba);
+  fetched.wait(guard, [&] { return slot.lba == lba; });
+  memory::copy(current, slot.data, SectorSize);
+  currentLBA = lba;
+  return current;
+}
+
+//sectors nearest to the read position are fetched first; a seek preempts the remainder of the window
+auto CDPrefetch::worker() -> void {
+  std::unique_lock<std::mutex> guard(lock);
+  while(running) {
+    maybe<int> missing;
+    for(int lba : range(position, position + Window)) {
+      if(slot(lba).lba != lba) { missing = lba; break; }
+    }
+    if(!missing) { wake.wait(guard); continue; }
+    guard.unlock();
+    fetch(*missing);
+    guard.lock();
+  }
+}
+
+auto CDPrefetch::fetch(int lba) -> void {
+  int64_t sector = (int64_t)leadIn + lba;
+  if(sector >= 0 && sector < sectors) {
+    file->seek(sector * SectorSize);
+    file->read(buffer, SectorSize);
+  } else {
+    memory::fill(buffer, SectorSize);
+  }
+
+  {
+    std::lock_guard<std::mutex> guard(lock);
+    auto& slot = this->slot(lba);
+    memory::copy(slot.data, buffer, SectorSize);
+    slot.lba = lba;
+  }
+  fetched.notify_one();
+}
+
+}
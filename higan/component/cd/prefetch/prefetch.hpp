@@ -0,0 +1,60 @@
+#pragma once
+
+#include <condition_variable>
+
+namespace higan {
+
+//CD-ROM sector read-ahead
+//sectors are read from the disc image on a worker thread, into a cache that follows the read position.
+//drives hint where reading will continue as soon as a seek is issued, so that the destination sectors are
+//usually cached long before the emulated seek latency has elapsed. the emulation thread only waits on
+//the worker when the host storage cannot keep up.
+
+struct CDPrefetch {
+  enum : uint { SectorSize = 2448 };
+  enum : uint { Slots  = 64 };  //sectors cached (must be a power of two)
+  enum : uint { Window = 32 };  //sectors read ahead of the read position (must be less than Slots)
+
+  ~CDPrefetch() { unload(); }
+
+  //the file is owned by the worker until unload(): it must not be accessed elsewhere in the meantime
+  auto load(Shared::File file, uint leadIn) -> void;
+  auto unload() -> void;
+
+  auto seek(int lba) -> void;
+  auto read(int lba) -> const uint8_t*;
+
+private:
+  enum : int64_t { Empty = INT64_MIN };
+
+  struct Slot {
+    int64_t lba = Empty;
+    uint8_t data[SectorSize];
+  };
+
+  auto slot(int lba) -> Slot& { return slots[lba & Slots - 1]; }
+  auto worker() -> void;
+  auto fetch(int lba) -> void;
+
+  //owned by the worker thread
+  Shared::File file;
+  uint leadIn = 0;
+  uint sectors = 0;
+  uint8_t buffer[SectorSize];
+
+  //owned by the emulation thread
+  int64_t currentLBA = Empty;
+  uint8_t current[SectorSize];
+
+  //shared between both threads under lock
+  std::mutex lock;
+  std::condition_variable wake;     //signaled when the read position moves, or when unloading
+  std::condition_variable fetched;  //signaled when a sector has been cached
+  int position = 0;
+  Slot slots[Slots];
+  bool running = false;
+
+  nall::thread thread;
+};
+
+}
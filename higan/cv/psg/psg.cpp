@@ -17,6 +17,7 @@ auto PSG::load(Node::Object parent) -> void {
 auto PSG::unload() -> void {
   node = {};
   stream = {};
+  Timer::destroy();
 }
 
 auto PSG::main() -> void {
@@ -27,17 +28,16 @@ auto PSG::main() -> void {
   output += volume[channels[2]];
   output += volume[channels[3]];
   stream->sample(output / 4.0);
-  step(1);
 }
 
-auto PSG::step(uint clocks) -> void {
-  Thread::step(clocks);
-  Thread::synchronize(cpu);
+auto PSG::write(uint8 data) -> void {
+  Timer::synchronize();
+  SN76489::write(data);
 }
 
 auto PSG::power() -> void {
   SN76489::power();
-  Thread::create(system.colorburst() / 16.0, {&PSG::main, this});
+  Timer::create(system.colorburst() / 16.0, {&PSG::main, this}, 256);
 
   for(uint level : range(15)) {
     volume[level] = pow(2, level * -2.0 / 6.0);
@@ -13,11 +13,15 @@ auto CPU::load(Node::Object parent) -> void {
 
   node = parent->append<Node::Component>("CPU");
 
+  //runs the PPU inline from the CPU, rather than switching to the PPU thread on every CPU cycle
+  fusedPPU = node->append<Node::Boolean>("Fused PPU", true);
+
   debugger.load(node);
 }
 
 auto CPU::unload() -> void {
   ram.reset();
+  fusedPPU = {};
   debugger = {};
   node = {};
 }
@@ -34,7 +38,14 @@ auto CPU::main() -> void {
 
 auto CPU::step(uint clocks) -> void {
   Thread::step(clocks);
-  Thread::synchronize();
+  if(!io.fusedPPU) return Thread::synchronize();
+
+  //the PPU is run to the same point, and in the same order relative to the other threads,
+  //as when Thread::synchronize() switches to it: until it has passed the CPU by one dot.
+  Thread::synchronize(cartridge, apu);
+  if(ppu.clock() < clock()) {
+    do ppu.cycle(); while(ppu.clock() <= clock());
+  }
 }
 
 auto CPU::power(bool reset) -> void {
@@ -52,6 +63,7 @@ auto CPU::power(bool reset) -> void {
   r.pc.byte(1) = readBus(0xfffd);
 
   io = {};
+  io.fusedPPU = fusedPPU->value();
 }
 
 }
@@ -1,5 +1,6 @@
 struct CPU : MOS6502, Thread {
   Node::Component node;
+  Node::Boolean fusedPPU;
   Memory::Writable<uint8> ram;
 
   struct Debugger {
@@ -67,6 +68,7 @@ struct CPU : MOS6502, Thread {
     uint16 rdyAddressValue;
      uint1 oamDMAPending;
      uint8 oamDMAPage;
+     uint1 fusedPPU;  //latched from the setting on power
   } io;
 };
 
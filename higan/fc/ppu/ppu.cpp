@@ -48,28 +48,34 @@ auto PPU::unload() -> void {
 }
 
 auto PPU::main() -> void {
-  renderScanline();
+  //when fused, the CPU runs the PPU (see CPU::step): this thread is still entered by the scheduler,
+  //eg after synchronizing for a save state, but must only yield back to the CPU without running a dot.
+  if(cpu.io.fusedPPU) return Thread::synchronize(cpu);
+  cycle();
+  Thread::synchronize(cpu);
 }
 
-auto PPU::step(uint clocks) -> void {
-  uint L = vlines();
+//runs a single dot. the PPU keeps no state on its stack between dots,
+//so this is also called directly by the CPU when the PPU is fused (see CPU::step.)
+auto PPU::cycle() -> void {
+  if(io.lx == 341 || (io.lx == 340 && latch.skip)) scanline();
+
+  renderCycle();
 
-  while(clocks--) {
-    if(io.ly == 240 && io.lx == 340) io.nmiHold = 1;
-    if(io.ly == 241 && io.lx ==   0) io.nmiFlag = io.nmiHold;
-    if(io.ly == 241 && io.lx ==   2) cpu.nmiLine(io.nmiEnable && io.nmiFlag);
+  uint L = vlines();
 
-    if(io.ly == L-2 && io.lx == 340) io.spriteZeroHit = 0, io.spriteOverflow = 0;
+  if(io.ly == 240 && io.lx == 340) io.nmiHold = 1;
+  if(io.ly == 241 && io.lx ==   0) io.nmiFlag = io.nmiHold;
+  if(io.ly == 241 && io.lx ==   2) cpu.nmiLine(io.nmiEnable && io.nmiFlag);
 
-    if(io.ly == L-2 && io.lx == 340) io.nmiHold = 0;
-    if(io.ly == L-1 && io.lx ==   0) io.nmiFlag = io.nmiHold;
-    if(io.ly == L-1 && io.lx ==   2) cpu.nmiLine(io.nmiEnable && io.nmiFlag);
+  if(io.ly == L-2 && io.lx == 340) io.spriteZeroHit = 0, io.spriteOverflow = 0;
 
-    Thread::step(rate());
-    Thread::synchronize(cpu);
+  if(io.ly == L-2 && io.lx == 340) io.nmiHold = 0;
+  if(io.ly == L-1 && io.lx ==   0) io.nmiFlag = io.nmiHold;
+  if(io.ly == L-1 && io.lx ==   2) cpu.nmiLine(io.nmiEnable && io.nmiFlag);
 
-    io.lx++;
-  }
+  Thread::step(rate());
+  io.lx++;
 }
 
 auto PPU::scanline() -> void {
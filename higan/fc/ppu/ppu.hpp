@@ -26,7 +26,7 @@ struct PPU : Thread {
   auto unload() -> void;
 
   auto main() -> void;
-  auto step(uint clocks) -> void;
+  auto cycle() -> void;
 
   auto scanline() -> void;
   auto frame() -> void;
@@ -48,9 +48,11 @@ struct PPU : Thread {
   auto enable() const -> bool;
   auto loadCHR(uint16 address) -> uint8;
 
+  auto fetchNametable() -> void;
+  auto fetchAttribute() -> void;
   auto renderPixel() -> void;
   auto renderSprite() -> void;
-  auto renderScanline() -> void;
+  auto renderCycle() -> void;
 
   //color.cpp
   auto color(uint32) -> uint64;
@@ -135,6 +137,17 @@ struct PPU : Thread {
 
     OAM oam[8];   //primary
     OAM soam[8];  //secondary
+
+    //the tile being fetched, before it is loaded into the shift registers above
+    struct Fetch {
+       uint8 nametable;
+       uint8 attribute;
+       uint8 tiledataLo;
+       uint8 tiledataHi;
+      uint16 address;
+    } fetch;
+
+    uint1 skip;  //the last dot of this scanline is skipped
   } latch;
 };
 
@@ -6,6 +6,18 @@ auto PPU::loadCHR(uint16 address) -> uint8 {
   return enable() ? cartridge.readCHR(address) : (uint8)0x00;
 }
 
+auto PPU::fetchNametable() -> void {
+  latch.fetch.nametable = loadCHR(0x2000 | (uint12)io.v.address);
+  latch.fetch.address = io.bgAddress | latch.fetch.nametable << 4 | io.v.fineY;
+}
+
+auto PPU::fetchAttribute() -> void {
+  uint attribute = loadCHR(0x23c0 | io.v.nametable << 10 | (io.v.tileY >> 2) << 3 | io.v.tileX >> 2);
+  if(io.v.tileY & 2) attribute >>= 4;
+  if(io.v.tileX & 2) attribute >>= 2;
+  latch.fetch.attribute = attribute;
+}
+
 auto PPU::renderPixel() -> void {
   uint32* output = buffer + io.ly * 256;
 
@@ -77,135 +89,102 @@ auto PPU::renderSprite() -> void {
   o.x    = oam[n * 4 + 3];
 }
 
-auto PPU::renderScanline() -> void {
+auto PPU::renderCycle() -> void {
   //Vblank
-  if(io.ly >= 240 && io.ly <= vlines() - 2) return step(341), scanline();
+  if(io.ly >= 240 && io.ly <= vlines() - 2) return;
 
-  latch.oamIterator = 0;
-  latch.oamCounter = 0;
+  uint lx = io.lx;
+  auto& fetch = latch.fetch;
 
-  for(auto n : range(8)) latch.soam[n] = {};
+  //load the tile fetched over the previous eight dots
+  if((lx - 1 & 7) == 0 && ((lx >= 9 && lx <= 257) || lx == 329 || lx == 337)) {
+    latch.nametable = latch.nametable << 8 | fetch.nametable;
+    latch.attribute = latch.attribute << 2 | (fetch.attribute & 3);
+    latch.tiledataLo = latch.tiledataLo << 8 | fetch.tiledataLo;
+    latch.tiledataHi = latch.tiledataHi << 8 | fetch.tiledataHi;
+  }
 
   //  0
-  step(1);
+  if(lx == 0) {
+    latch.oamIterator = 0;
+    latch.oamCounter = 0;
 
-  //  1-256
-  for(uint tile : range(32)) {
-    uint nametable = loadCHR(0x2000 | (uint12)io.v.address);
-    uint tileaddr = io.bgAddress | nametable << 4 | io.v.fineY;
-    renderPixel();
-    step(1);
-
-    renderPixel();
-    step(1);
-
-    uint attribute = loadCHR(0x23c0 | io.v.nametable << 10 | (io.v.tileY >> 2) << 3 | io.v.tileX >> 2);
-    if(io.v.tileY & 2) attribute >>= 4;
-    if(io.v.tileX & 2) attribute >>= 2;
-    renderPixel();
-    step(1);
-
-    if(enable() && ++io.v.tileX == 0) io.v.nametableX++;
-    if(enable() && tile == 31 && ++io.v.fineY == 0 && ++io.v.tileY == 30) io.v.nametableY++, io.v.tileY = 0;
-    renderPixel();
-    renderSprite();
-    step(1);
-
-    uint tiledataLo = loadCHR(tileaddr + 0);
-    renderPixel();
-    step(1);
-
-    renderPixel();
-    step(1);
-
-    uint tiledataHi = loadCHR(tileaddr + 8);
-    renderPixel();
-    step(1);
+    for(auto n : range(8)) latch.soam[n] = {};
+    return;
+  }
 
+  //  1-256
+  if(lx <= 256) {
+    switch(lx - 1 & 7) {
+    case 0: fetchNametable(); break;
+    case 2: fetchAttribute(); break;
+    case 3:
+      if(enable() && ++io.v.tileX == 0) io.v.nametableX++;
+      if(enable() && lx == 252 && ++io.v.fineY == 0 && ++io.v.tileY == 30) io.v.nametableY++, io.v.tileY = 0;
+      break;
+    case 4: fetch.tiledataLo = loadCHR(fetch.address + 0); break;
+    case 6: fetch.tiledataHi = loadCHR(fetch.address + 8); break;
+    }
     renderPixel();
-    renderSprite();
-    step(1);
-
-    latch.nametable = latch.nametable << 8 | nametable;
-    latch.attribute = latch.attribute << 2 | (attribute & 3);
-    latch.tiledataLo = latch.tiledataLo << 8 | tiledataLo;
-    latch.tiledataHi = latch.tiledataHi << 8 | tiledataHi;
+    if((lx & 3) == 0) renderSprite();
+    return;
   }
 
-  for(auto n : range(8)) latch.oam[n] = latch.soam[n];
-
   //257-320
-  for(uint sprite : range(8)) {
-    uint nametable = loadCHR(0x2000 | (uint12)io.v.address);
-    step(1);
-
-    if(enable() && sprite == 0) {
-      //258
-      io.v.nametableX = io.t.nametableX;
-      io.v.tileX = io.t.tileX;
+  if(lx <= 320) {
+    uint sprite = lx - 257 >> 3;
+    auto& o = latch.oam[sprite];
+    switch(lx - 257 & 7) {
+    case 0:
+      if(sprite == 0) {
+        for(auto n : range(8)) latch.oam[n] = latch.soam[n];
+      }
+      if(enable() && sprite == 7 && io.ly == vlines() - 1) {
+        //305
+        io.v.address = io.t.address;
+      }
+      loadCHR(0x2000 | (uint12)io.v.address);
+      break;
+    case 1:
+      if(enable() && sprite == 0) {
+        //258
+        io.v.nametableX = io.t.nametableX;
+        io.v.tileX = io.t.tileX;
+      }
+      break;
+    case 2:
+      loadCHR(0x23c0 | io.v.nametable << 10 | (io.v.tileY >> 2) << 3 | io.v.tileX >> 2);
+      fetch.address = io.spriteHeight == 8
+      ? io.spriteAddress + o.tile * 16
+      : (o.tile & ~1) * 16 + (o.tile & 1) * 0x1000;
+      break;
+    case 4: {
+      uint spriteY = (io.ly - o.y) & (io.spriteHeight - 1);
+      if(o.attr & 0x80) spriteY ^= io.spriteHeight - 1;
+      fetch.address += spriteY + (spriteY & 8);
+      o.tiledataLo = loadCHR(fetch.address + 0);
+      break;
     }
-    step(1);
-
-    uint attribute = loadCHR(0x23c0 | io.v.nametable << 10 | (io.v.tileY >> 2) << 3 | io.v.tileX >> 2);
-    uint tileaddr = io.spriteHeight == 8
-    ? io.spriteAddress + latch.oam[sprite].tile * 16
-    : (latch.oam[sprite].tile & ~1) * 16 + (latch.oam[sprite].tile & 1) * 0x1000;
-    step(2);
-
-    uint spriteY = (io.ly - latch.oam[sprite].y) & (io.spriteHeight - 1);
-    if(latch.oam[sprite].attr & 0x80) spriteY ^= io.spriteHeight - 1;
-    tileaddr += spriteY + (spriteY & 8);
-
-    latch.oam[sprite].tiledataLo = loadCHR(tileaddr + 0);
-    step(2);
-
-    latch.oam[sprite].tiledataHi = loadCHR(tileaddr + 8);
-    step(2);
-
-    if(enable() && sprite == 6 && io.ly == vlines() - 1) {
-      //305
-      io.v.address = io.t.address;
+    case 6:
+      o.tiledataHi = loadCHR(fetch.address + 8);
+      break;
     }
+    return;
   }
 
   //321-336
-  for(uint tile : range(2)) {
-    uint nametable = loadCHR(0x2000 | (uint12)io.v.address);
-    uint tileaddr = io.bgAddress | nametable << 4 | io.v.fineY;
-    step(2);
-
-    uint attribute = loadCHR(0x23c0 | io.v.nametable << 10 | (io.v.tileY >> 2) << 3 | io.v.tileX >> 2);
-    if(io.v.tileY & 2) attribute >>= 4;
-    if(io.v.tileX & 2) attribute >>= 2;
-    step(1);
-
-    if(enable() && ++io.v.tileX == 0) io.v.nametableX++;
-    step(1);
-
-    uint tiledataLo = loadCHR(tileaddr + 0);
-    step(2);
-
-    uint tiledataHi = loadCHR(tileaddr + 8);
-    step(2);
-
-    latch.nametable = latch.nametable << 8 | nametable;
-    latch.attribute = latch.attribute << 2 | (attribute & 3);
-    latch.tiledataLo = latch.tiledataLo << 8 | tiledataLo;
-    latch.tiledataHi = latch.tiledataHi << 8 | tiledataHi;
+  if(lx <= 336) {
+    switch(lx - 321 & 7) {
+    case 0: fetchNametable(); break;
+    case 2: fetchAttribute(); break;
+    case 3: if(enable() && ++io.v.tileX == 0) io.v.nametableX++; break;
+    case 4: fetch.tiledataLo = loadCHR(fetch.address + 0); break;
+    case 6: fetch.tiledataHi = loadCHR(fetch.address + 8); break;
+    }
+    return;
   }
 
-  //337-338
-  loadCHR(0x2000 | (uint12)io.v.address);
-  step(1);
-  bool skip = enable() && io.field == 1 && io.ly == vlines() - 1;
-  step(1);
-
-  //339
-  loadCHR(0x2000 | (uint12)io.v.address);
-  step(1);
-
-  //340
-  if(!skip) step(1);
-
-  return scanline();
+  //337-340
+  if(lx == 337 || lx == 339) loadCHR(0x2000 | (uint12)io.v.address);
+  if(lx == 338) latch.skip = enable() && io.field == 1 && io.ly == vlines() - 1;
 }
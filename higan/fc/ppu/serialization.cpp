@@ -48,6 +48,14 @@ auto PPU::serialize(serializer& s) -> void {
 
   for(auto& o : latch.oam) o.serialize(s);
   for(auto& o : latch.soam) o.serialize(s);
+
+  s.integer(latch.fetch.nametable);
+  s.integer(latch.fetch.attribute);
+  s.integer(latch.fetch.tiledataLo);
+  s.integer(latch.fetch.tiledataHi);
+  s.integer(latch.fetch.address);
+
+  s.integer(latch.skip);
 }
 
 auto PPU::OAM::serialize(serializer& s) -> void {
@@ -4,19 +4,47 @@ namespace higan::GameBoy {
 
 Bus bus;
 
-auto Bus::read(uint cycle, uint16 address, uint8 data) -> uint8 {
-  data &= cpu.readIO(cycle, address, data);
-  data &= apu.readIO(cycle, address, data);
-  data &= ppu.readIO(cycle, address, data);
-  data &= cartridge.readIO(cycle, address, data);
+//the decode tables mirror the address ranges that each component's readIO() and writeIO() respond to.
+//where ranges overlap, every mapped component is still consulted, in the same order as before.
+Bus::Bus() {
+  for(uint page : range(256)) {
+    uint16 address = page << 8;
+    if(address <= 0x7fff) pages[page] = Cartridge;  //ROM
+    else if(address <= 0x9fff) pages[page] = PPU;   //VRAM
+    else if(address <= 0xbfff) pages[page] = Cartridge;  //SRAM
+    else if(address <= 0xfdff) pages[page] = WRAM;
+    else pages[page] = PPU;  //OAM
+  }
+
+  for(uint offset : range(256)) {
+    if(offset <= 0x0f) io[offset] = CPU;
+    else if(offset <= 0x3f) io[offset] = APU;
+    else if(offset <= 0x7f) io[offset] = CPU | PPU;
+    else if(offset <= 0xfe) io[offset] = HRAM;
+    else io[offset] = CPU;  //IE
+  }
+  io[0x50] |= Cartridge;  //boot ROM disable
+}
+
+auto Bus::readDecoded(uint16 address, uint8 data) -> uint8 {
+  auto components = decode(address);
+  if(components == WRAM) return data & cpu.wram[cpu.wramAddress(address)];
+  if(components == HRAM) return data & cpu.hram[(uint7)address];
+  if(components & CPU) data &= cpu.readIO(2, address, data);
+  if(components & APU) data &= apu.readIO(2, address, data);
+  if(components & PPU) data &= ppu.readIO(2, address, data);
+  if(components & Cartridge) data &= cartridge.readIO(2, address, data);
   return data;
 }
 
-auto Bus::write(uint cycle, uint16 address, uint8 data) -> void {
-  cpu.writeIO(cycle, address, data);
-  apu.writeIO(cycle, address, data);
-  ppu.writeIO(cycle, address, data);
-  cartridge.writeIO(cycle, address, data);
+auto Bus::writeDecoded(uint cycle, uint16 address, uint8 data) -> void {
+  auto components = decode(address);
+  if(components == WRAM) { if(cycle == 2) cpu.wram[cpu.wramAddress(address)] = data; return; }
+  if(components == HRAM) { if(cycle == 2) cpu.hram[(uint7)address] = data; return; }
+  if(components & CPU) cpu.writeIO(cycle, address, data);
+  if(components & APU) apu.writeIO(cycle, address, data);
+  if(components & PPU) ppu.writeIO(cycle, address, data);
+  if(components & Cartridge) cartridge.writeIO(cycle, address, data);
 }
 
 auto Bus::read(uint16 address, uint8 data) -> uint8 {
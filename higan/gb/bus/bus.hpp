@@ -1,9 +1,33 @@
 struct Bus {
-  auto read(uint cycle, uint16 address, uint8 data) -> uint8;
-  auto write(uint cycle, uint16 address, uint8 data) -> void;
+  //components that respond to bus accesses.
+  //WRAM and HRAM are owned by the CPU, but are decoded separately so that they can be accessed directly.
+  enum : uint { CPU = 1 << 0, APU = 1 << 1, PPU = 1 << 2, Cartridge = 1 << 3, WRAM = 1 << 4, HRAM = 1 << 5 };
+
+  Bus();
+
+  //reads only have an effect on cycle 2 of a memory access, and writes only on cycles 2 and 4.
+  //all other cycles are filtered out here, before any component is consulted.
+  auto read(uint cycle, uint16 address, uint8 data) -> uint8 {
+    return cycle == 2 ? readDecoded(address, data) : data;
+  }
+
+  auto write(uint cycle, uint16 address, uint8 data) -> void {
+    if(cycle == 2 || cycle == 4) writeDecoded(cycle, address, data);
+  }
 
   auto read(uint16 address, uint8 data) -> uint8;
   auto write(uint16 address, uint8 data) -> void;
+
+private:
+  auto decode(uint16 address) const -> uint8 {
+    return address < 0xff00 ? pages[address >> 8] : io[(uint8)address];
+  }
+
+  auto readDecoded(uint16 address, uint8 data) -> uint8;
+  auto writeDecoded(uint cycle, uint16 address, uint8 data) -> void;
+
+  uint8 pages[256];  //components mapped to each 256-byte page from $0000-feff
+  uint8 io[256];     //components mapped to each address from $ff00-ffff
 };
 
 extern Bus bus;
@@ -102,7 +102,8 @@ auto PPU::main() -> void {
     if(io.vcoincidence) cpu.irq.flag |= CPU::Interrupt::VCoincidence;
   }
 
-  if(io.vcounter < 160) {
+  //rendering has no side effects beyond the output buffer, so it can be skipped when the frame will be discarded
+  if(io.vcounter < 160 && !screen->skip()) {
     uint y = io.vcounter;
     bg0.scanline(y);
     bg1.scanline(y);
@@ -1,5 +1,6 @@
 #include <higan/higan.hpp>
 #include <higan/debug/debug.cpp>
+#include <higan/profiler/profiler.cpp>
 #include <higan/node/node.cpp>
 #include <higan/resource/resource.cpp>
 
@@ -19,6 +19,7 @@
 #include <nall/shared-pointer.hpp>
 #include <nall/string.hpp>
 #include <nall/terminal.hpp>
+#include <nall/thread.hpp>
 #include <nall/traits.hpp>
 #include <nall/unique-pointer.hpp>
 #include <nall/variant.hpp>
@@ -63,6 +64,7 @@ namespace higan {
 #include <higan/debug/debug.hpp>
 #include <higan/node/node.hpp>
 #include <higan/platform.hpp>
+#include <higan/profiler/profiler.hpp>
 #include <higan/interface.hpp>
 #include <higan/memory/readable.hpp>
 #include <higan/memory/writable.hpp>
@@ -1,4 +1,6 @@
 #include <higan/scheduler/thread.hpp>
+#include <higan/scheduler/timer.hpp>
 #include <higan/scheduler/scheduler.hpp>
 #include <higan/scheduler/thread.cpp>
+#include <higan/scheduler/timer.cpp>
 #include <higan/scheduler/scheduler.cpp>
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <higan/memory/memory.hpp>
+
+namespace higan::Memory {
+
+//maps ROM images directly from their files, rather than copying them onto the heap.
+//pages are mapped copy-on-write: until written to, they are shared through the host page cache
+//with every other mapping of the same file, whether by this process or by any other.
+//the region beyond the end of the image is mirrored by mapping the same file pages again.
+//mapping is disabled by default: if a mapped file is truncated or replaced in place while in use, accessing it
+//raises SIGBUS, and pages not yet written to would observe external modifications. the frontend enables it on request.
+struct Mapping {
+  static inline bool enabled = false;
+
+  static auto map(shared_pointer<vfs::file> fp, uint size, uint capacity, uint width) -> void*;
+  static auto unmap(void* data, uint capacity, uint width) -> void;
+};
+
+//size is the image size, and capacity the mirrored size, both in units of width bytes.
+//returns nullptr if the image cannot be mapped, in which case it should be read instead.
+inline auto Mapping::map(shared_pointer<vfs::file> fp, uint size, uint capacity, uint width) -> void* {
+  #if defined(PLATFORM_WINDOWS)
+  return nullptr;
+  #else
+  if(!enabled) return nullptr;
+  auto location = fp->location();
+  if(!location || !size || capacity < size) return nullptr;
+
+  //within each aligned block of this many units, mirror() is linear
+  uint block = size & -size;
+  uintmax page = sysconf(_SC_PAGESIZE);
+  uintmax offset = fp->offset();
+  uintmax bytes = (uintmax)size * width;
+  if(offset % page || (uintmax)block * width % page) return nullptr;
+  if(fp->size() < offset + bytes) return nullptr;
+
+  int fd = open(location, O_RDONLY);
+  if(fd < 0) return nullptr;
+
+  //reserve the entire region first, so that the image and its mirrors are contiguous
+  uintmax total = (uintmax)capacity * width;
+  auto base = (uint8_t*)mmap(nullptr, total, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if(base == MAP_FAILED) return close(fd), nullptr;
+
+  auto alias = [&](uint address, uint source, uint length) -> bool {
+    auto target = base + (uintmax)address * width;
+    auto result = mmap(target, (uintmax)length * width, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_FIXED, fd, offset + (uintmax)source * width);
+    return result == target;
+  };
+
+  bool valid = alias(0, 0, size);
+  for(uint address = size; valid && address < capacity;) {
+    uint source = mirror(address, size);
+    uint length = block;
+    //merge consecutive blocks that mirror contiguous parts of the image
+    while(address + length < capacity && mirror(address + length, size) == source + length) length += block;
+    valid = alias(address, source, length);
+    address += length;
+  }
+  close(fd);
+
+  if(!valid) return munmap(base, total), nullptr;
+  fp->seek(bytes, vfs::file::index::relative);
+  return base;
+  #endif
+}
+
+inline auto Mapping::unmap(void* data, uint capacity, uint width) -> void {
+  #if !defined(PLATFORM_WINDOWS)
+  if(data) munmap(data, (uintmax)capacity * width);
+  #endif
+}
+
+}
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <higan/memory/memory.hpp>
+#include <higan/memory/mapping.hpp>
 
 namespace higan::Memory {
 
@@ -9,15 +10,14 @@ struct Readable {
   ~Readable() { reset(); }
 
   auto reset() -> void {
-    delete[] self.data;
-    self.data = nullptr;
+    release();
     self.size = 0;
     self.mask = 0;
   }
 
   auto allocate(uint size, T fill = ~0ull) -> void {
     if(!size) return reset();
-    delete[] self.data;
+    release();
     self.size = size;
     self.mask = bit::round(self.size) - 1;
     self.data = new T[self.mask + 1];
@@ -30,8 +30,15 @@ struct Readable {
     }
   }
 
+  //images that fill the entire allocation are mapped from their file when possible.
   auto load(shared_pointer<vfs::file> fp) -> void {
     if(!self.size) return;
+    if(auto data = Mapping::map(fp, self.size, self.mask + 1, sizeof(T))) {
+      release();
+      self.data = (T*)data;
+      self.mapped = true;
+      return;
+    }
     fp->read(self.data, min(fp->size(), self.size * sizeof(T)));
     for(uint address = self.size; address <= self.mask; address++) {
       self.data[address] = self.data[mirror(address, self.size)];
@@ -68,10 +75,18 @@ struct Readable {
   }
 
 private:
+  auto release() -> void {
+    if(self.mapped) Mapping::unmap(self.data, self.mask + 1, sizeof(T));
+    else delete[] self.data;
+    self.data = nullptr;
+    self.mapped = false;
+  }
+
   struct {
     T* data = nullptr;
     uint size = 0;
     uint mask = 0;
+    bool mapped = false;
   } self;
 };
 
@@ -35,6 +35,12 @@ auto Stream::setMuted(bool muted) -> void {
   _muted = muted;
 }
 
+//while fast forwarding, samples are discarded before filtering and resampling.
+//this only affects output: the emulated sound hardware continues to run normally.
+auto Stream::setFastForward(bool fastForward) -> void {
+  _fastForward = fastForward;
+}
+
 auto Stream::resetFilters() -> void {
   for(auto& channel : _channels) {
     channel.filters.reset();
@@ -109,6 +115,7 @@ auto Stream::read(double samples[]) -> uint {
 }
 
 auto Stream::write(const double samples[]) -> void {
+  Profiler::Scope scope{Profiler::Section::Write};
   for(uint c : range(_channels.size())) {
     double sample = samples[c] + 1e-25;  //constant offset used to suppress denormals
     for(auto& filter : _channels[c].filters) {
@@ -6,11 +6,13 @@ struct Stream : Object {
   auto frequency() const -> double { return _frequency; }
   auto resamplerFrequency() const -> double { return _resamplerFrequency; }
   auto muted() const -> bool { return _muted; }
+  auto fastForward() const -> bool { return _fastForward; }
 
   auto setChannels(uint channels) -> void;
   auto setFrequency(double frequency) -> void;
   auto setResamplerFrequency(double resamplerFrequency) -> void;
   auto setMuted(bool muted) -> void;
+  auto setFastForward(bool fastForward) -> void;
 
   auto resetFilters() -> void;
   auto addLowPassFilter(double cutoffFrequency, uint order, uint passes = 1) -> void;
@@ -24,7 +26,7 @@ struct Stream : Object {
 
   template<typename... P>
   auto sample(P&&... p) -> void {
-    if(runAhead()) return;
+    if(runAhead() || _fastForward) return;
     double samples[sizeof...(p)] = {forward<P>(p)...};
     write(samples);
   }
@@ -46,4 +48,5 @@ protected:
   double _frequency = 48000.0;
   double _resamplerFrequency = 48000.0;
   bool _muted = false;
+  bool _fastForward = false;
 };
@@ -1,6 +1,14 @@
 struct Input : Object {
   DeclareClass(Input, "Input")
   using Object::Object;
+
+  //opaque frontend data (eg the host input an emulated input is mapped to.)
+  //inputs are polled many times per frame, so this avoids attribute lookups by name.
+  template<typename T = void> auto userData() const -> T* { return (T*)_userData; }
+  auto setUserData(void* userData) -> void { _userData = userData; }
+
+protected:
+  void* _userData = nullptr;
 };
 
 struct Button : Input {
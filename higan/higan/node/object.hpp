@@ -10,18 +10,19 @@
 struct Object : shared_pointer_this<Object> {
   DeclareClass(Object, "Object")
 
-  Object(string name = {}) : _name(name) {}
+  Object(string name = {}) : _name(name), _revision(++_revisions) {}
   virtual ~Object() = default;
 
   auto name() const -> string { return _name; }
   auto parent() const -> shared_pointer_weak<Object> { return _parent; }
 
-  auto setName(string_view name) -> void { _name = name; }
+  auto setName(string_view name) -> void { _name = name; modified(); }
 
   auto prepend(Node::Object node) -> Node::Object {
     if(auto found = find(node)) return found;
     _nodes.prepend(node);
     node->_parent = shared();
+    modified();
     PlatformAttach(node);
     return node;
   }
@@ -36,6 +37,7 @@ struct Object : shared_pointer_this<Object> {
     if(auto found = find(node)) return found;
     _nodes.append(node);
     node->_parent = shared();
+    modified();
     PlatformAttach(node);
     return node;
   }
@@ -52,6 +54,7 @@ struct Object : shared_pointer_this<Object> {
       node->reset();
       node->_parent.reset();
       _nodes.remove(*index);
+      modified();
     }
   }
 
@@ -62,6 +65,7 @@ struct Object : shared_pointer_this<Object> {
       node->_parent.reset();
     }
     _nodes.reset();
+    modified();
   }
 
   template<typename T>
@@ -75,13 +79,34 @@ struct Object : shared_pointer_this<Object> {
     return (bool)cast<T>();
   }
 
+  //the descendants matched by typed searches are cached per node, and are only collected again after this subtree is modified.
+  //the cache holds weak references, so that it never keeps removed nodes alive.
   template<typename T>
   auto find() -> vector<shared_pointer<typename T::type>> {
-    vector<shared_pointer<typename T::type>> result;
-    if(dynamic_cast<typename T::type*>(this)) {
+    using Type = typename T::type;
+    using Matches = vector<shared_pointer_weak<Type>>;
+    Cache* cache = nullptr;
+    for(auto& entry : _caches) {
+      if(entry.type == &CacheType<T>) { cache = &entry; break; }
+    }
+    if(!cache) {
+      _caches.append({&CacheType<T>});
+      cache = &_caches.last();
+    }
+    if(cache->revision != _revision || !cache->matches.template is<Matches>()) {
+      Matches matches;
+      for(auto& node : _nodes) node->collect<T>(matches);
+      cache->matches = matches;
+      cache->revision = _revision;
+    }
+
+    vector<shared_pointer<Type>> result;
+    if(dynamic_cast<Type*>(this)) {
       if(auto instance = shared()) result.append(instance);
     }
-    for(auto& node : _nodes) result.append(node->find<T>());
+    for(auto& match : cache->matches.template get<Matches>()) {
+      if(auto instance = match.acquire()) result.append(instance);
+    }
     return result;
   }
 
@@ -102,12 +127,16 @@ struct Object : shared_pointer_this<Object> {
 
   template<typename T = Node::Object>
   auto find(string name) -> T {
+    return resolve<T>(name.split("/"));
+  }
+
+  template<typename T = Node::Object>
+  auto resolve(const vector<string>& path, uint depth = 0) -> T {
     using Type = typename T::type;
-    auto path = name.split("/");
-    name = path.takeFirst();
+    if(depth >= path.size()) return {};
     for(auto& node : _nodes) {
-      if(node->_name != name) continue;
-      if(path) return node->find<T>(path.merge("/"));
+      if(node->_name != path[depth]) continue;
+      if(depth + 1 < path.size()) return node->resolve<T>(path, depth + 1);
       if(node->identity() == Type::identifier) return node;
     }
     return {};
@@ -179,6 +208,7 @@ struct Object : shared_pointer_this<Object> {
   virtual auto unserialize(Markup::Node markup) -> void {
     if(!markup) return;
     _name = markup["name"].text();
+    modified();
     _attributes.reset();
     for(auto& attribute : markup.find("attribute")) {
       _attributes.insert({attribute["name"].text(), attribute["value"].text()});
@@ -206,6 +236,34 @@ struct Object : shared_pointer_this<Object> {
   auto end() { return _nodes.end(); }
 
 protected:
+  template<typename T>
+  auto collect(vector<shared_pointer_weak<typename T::type>>& result) -> void {
+    using Type = typename T::type;
+    if(dynamic_cast<Type*>(this)) {
+      if(auto instance = shared()) result.append(shared_pointer<Type>{instance});
+    }
+    for(auto& node : _nodes) node->collect<T>(result);
+  }
+
+  //assigns a new revision to this node and to each of its ancestors
+  auto modified() -> void {
+    _revision = ++_revisions;
+    for(auto node = _parent.acquire(); node; node = node->_parent.acquire()) node->_revision = _revision;
+  }
+
+  //each distinct type T is identified by the address of its own instantiation of this variable
+  template<typename T> static inline const char CacheType = 0;
+
+  struct Cache {
+    const void* type = nullptr;
+    uint64_t revision = 0;
+    any matches;  //vector<shared_pointer_weak<T::type>>: matching descendants, in preorder
+  };
+
+  //revisions are unique across all nodes, so that a cached revision can never match a different node
+  static inline uint64_t _revisions = 0;
+  uint64_t _revision = 0;
+  vector<Cache> _caches;
   string _name;
   set<Attribute> _attributes;
   shared_pointer_weak<Object> _parent;
@@ -23,8 +23,14 @@ auto Screen::colors(uint colors, function<uint64 (uint32)> color) -> void {
 }
 
 auto Screen::refresh(uint32* input, uint pitch, uint width, uint height) -> void {
+  Profiler::Scope scope{Profiler::Section::Refresh};
   if(runAhead()) return;
 
+  //when frame skipping, discard frames before performing any color conversion
+  bool skip = this->skip();
+  _frameCounter++;
+  if(skip) return;
+
   //allocate the screen buffers (only when growing)
   if(_renderWidth != width || _renderHeight != height) {
     if(_renderWidth * _renderHeight < width * height) {
@@ -17,6 +17,11 @@ struct Screen : Object {
   auto colorBleed() const -> bool { return _colorBleed; }
   auto interframeBlending() const -> bool { return _interframeBlending; }
   auto rotation() const -> uint { return _rotation; }
+  auto frameSkip() const -> uint { return _frameSkip; }
+
+  //returns true when the next call to refresh() will be discarded.
+  //cores may consult this to avoid rendering frames that will never be shown.
+  auto skip() const -> bool { return _frameSkip && _frameCounter % (_frameSkip + 1); }
 
   auto resetPalette() -> void;
   auto resetSprites() -> void;
@@ -32,6 +37,7 @@ struct Screen : Object {
   auto setColorBleed(bool colorBleed) -> void { _colorBleed = colorBleed; }
   auto setInterframeBlending(bool interframeBlending) -> void { _interframeBlending = interframeBlending; }
   auto setRotation(uint rotation) -> void { _rotation = rotation; }
+  auto setFrameSkip(uint frameSkip) -> void { _frameSkip = frameSkip; _frameCounter = 0; }
 
   auto attach(Node::Sprite) -> void;
   auto detach(Node::Sprite) -> void;
@@ -56,6 +62,8 @@ protected:
   bool _colorBleed = false;
   bool _interframeBlending = false;
   uint _rotation = 0;  //counter-clockwise (90 = left, 270 = right)
+  uint _frameSkip = 0;  //number of frames discarded after each frame that is output
+  uint _frameCounter = 0;
 
   function<uint64 (uint32)> _color;
   unique_pointer<uint32[]> _buffer;
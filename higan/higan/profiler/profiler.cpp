@@ -0,0 +1,183 @@
+#if defined(__GNUC__)
+  #include <cxxabi.h>
+#endif
+
+namespace higan {
+
+Profiler _profiler;
+
+//forwards every platform callback to the frontend, timing each as the Platform section.
+struct ProfilerPlatform : Platform {
+  auto attach(Node::Object node) -> void override { Profiler::Scope scope{Profiler::Section::Platform}; return target->attach(node); }
+  auto detach(Node::Object node) -> void override { Profiler::Scope scope{Profiler::Section::Platform}; return target->detach(node); }
+  auto open(Node::Object node, string name, vfs::file::mode mode, bool required) -> shared_pointer<vfs::file> override {
+    Profiler::Scope scope{Profiler::Section::Platform};
+    return target->open(node, name, mode, required);
+  }
+  auto event(Event event) -> void override {
+    { Profiler::Scope scope{Profiler::Section::Platform}; target->event(event); }
+    if(event == Event::Frame) _profiler.frame();
+  }
+  auto log(string_view message) -> void override { Profiler::Scope scope{Profiler::Section::Platform}; return target->log(message); }
+  auto video(Node::Screen screen, const uint32_t* data, uint pitch, uint width, uint height) -> void override {
+    Profiler::Scope scope{Profiler::Section::Platform};
+    return target->video(screen, data, pitch, width, height);
+  }
+  auto audio(Node::Stream stream) -> void override { Profiler::Scope scope{Profiler::Section::Platform}; return target->audio(stream); }
+  auto input(Node::Input input) -> void override { Profiler::Scope scope{Profiler::Section::Platform}; return target->input(input); }
+
+  Platform* target = nullptr;
+};
+
+auto Profiler::reset() -> void {
+  for(auto& record : _records) *record.counters = {};
+  for(auto& timing : _sections) timing = {};
+  _timestamp = chrono::nanosecond();
+  _frames = 0;
+}
+
+//type is the typeid() name of the thread, which is used to label its counters.
+auto Profiler::attach(Counters& counters, const char* type) -> void {
+  string name = type;
+  #if defined(__GNUC__)
+  int status = 0;
+  if(auto demangled = abi::__cxa_demangle(type, nullptr, nullptr, &status)) {
+    name = demangled;
+    free(demangled);
+  }
+  #endif
+  name.trimLeft("higan::", 1L);
+
+  //distinguish multiple instances of the same component (eg controllers)
+  uint instances = 0;
+  for(auto& record : _records) {
+    if(record.name == name || record.name.beginsWith({name, " #"})) instances++;
+  }
+  if(instances) name.append(" #", instances + 1);
+
+  counters = {};
+  _records.append({&counters, name});
+}
+
+auto Profiler::detach(Counters& counters) -> void {
+  if(_active == &counters) enter(nullptr);
+  for(uint index : range(_records.size())) {
+    if(_records[index].counters == &counters) return _records.remove(index);
+  }
+}
+
+//called immediately before switching to another thread: charges the elapsed host time to the previous thread.
+auto Profiler::enter(Counters* counters) -> void {
+  auto timestamp = chrono::nanosecond();
+  if(_active) _active->nanoseconds += timestamp - _timestamp;
+  _timestamp = timestamp;
+  _active = counters;
+  if(_active) _active->entries++;
+}
+
+auto Profiler::section(Section section, uint64_t nanoseconds) -> void {
+  auto& timing = _sections[(uint)section];
+  timing.nanoseconds += nanoseconds;
+  timing.calls++;
+  timing.frame += nanoseconds;
+}
+
+auto Profiler::frame() -> void {
+  for(auto& timing : _sections) {
+    timing.peak = max(timing.peak, timing.frame);
+    timing.frame = 0;
+  }
+  _frames++;
+}
+
+//the node is not attached to any system: the frontend decides where (and whether) to show it.
+auto Profiler::node() -> Node::Properties {
+  if(!_node) {
+    _node = Node::Properties::create("Profiler");
+    _node->setQuery([&] { return text(); });
+  }
+  return _node;
+}
+
+//returns a platform that times all callbacks before forwarding them to the given platform.
+auto Profiler::platform(Platform* target) -> Platform* {
+  static ProfilerPlatform platform;
+  platform.target = target;
+  return &platform;
+}
+
+auto Profiler::text() -> string {
+  auto frames = max(_frames, (uint64_t)1);
+  uint64_t total = 0;
+  for(auto& record : _records) total += record.counters->nanoseconds;
+
+  string output;
+  output.append("Frames: ", _frames, "\n\n");
+  for(auto& record : _records) {
+    auto& counters = *record.counters;
+    output.append(record.name, "\n");
+    output.append("  Time: ", counters.nanoseconds / frames / 1000, "us/frame (", total ? counters.nanoseconds * 100 / total : 0, "%)\n");
+    output.append("  Entries: ", counters.entries / frames, "/frame\n");
+    output.append("  Switches: ", counters.switches / frames, "/frame\n");
+    output.append("  Clocks: ", counters.clocks / frames, "/frame\n");
+  }
+  for(uint index : range((uint)Section::Count)) {
+    auto& timing = _sections[index];
+    output.append(name((Section)index), "\n");
+    output.append("  Time: ", timing.nanoseconds / frames / 1000, "us/frame (peak: ", timing.peak / 1000, "us)\n");
+    output.append("  Calls: ", timing.calls / frames, "/frame\n");
+  }
+  return output;
+}
+
+auto Profiler::csv() -> string {
+  string output;
+  output.append("type,name,frames,nanoseconds,entries,switches,clocks,calls,peak\n");
+  for(auto& record : _records) {
+    auto& counters = *record.counters;
+    output.append("thread,", record.name, ",", _frames, ",", counters.nanoseconds, ",");
+    output.append(counters.entries, ",", counters.switches, ",", counters.clocks, ",,\n");
+  }
+  for(uint index : range((uint)Section::Count)) {
+    auto& timing = _sections[index];
+    output.append("section,", name((Section)index), ",", _frames, ",", timing.nanoseconds, ",");
+    output.append(",,,", timing.calls, ",", timing.peak, "\n");
+  }
+  return output;
+}
+
+auto Profiler::json() -> string {
+  string output;
+  output.append("{\n");
+  output.append("  \"frames\": ", _frames, ",\n");
+  output.append("  \"threads\": [\n");
+  for(uint index : range(_records.size())) {
+    auto& record = _records[index];
+    auto& counters = *record.counters;
+    output.append("    {\"name\": \"", record.name, "\", \"nanoseconds\": ", counters.nanoseconds);
+    output.append(", \"entries\": ", counters.entries, ", \"switches\": ", counters.switches);
+    output.append(", \"clocks\": ", counters.clocks, "}", index + 1 < _records.size() ? "," : "", "\n");
+  }
+  output.append("  ],\n");
+  output.append("  \"sections\": [\n");
+  for(uint index : range((uint)Section::Count)) {
+    auto& timing = _sections[index];
+    output.append("    {\"name\": \"", name((Section)index), "\", \"nanoseconds\": ", timing.nanoseconds);
+    output.append(", \"calls\": ", timing.calls, ", \"peak\": ", timing.peak, "}");
+    output.append(index + 1 < (uint)Section::Count ? "," : "", "\n");
+  }
+  output.append("  ]\n");
+  output.append("}\n");
+  return output;
+}
+
+auto Profiler::name(Section section) -> string {
+  switch(section) {
+  case Section::Refresh: return "Screen::refresh";
+  case Section::Write: return "Stream::write";
+  case Section::Platform: return "Platform";
+  }
+  return {};
+}
+
+}
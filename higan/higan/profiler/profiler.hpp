@@ -0,0 +1,84 @@
+namespace higan {
+
+//per-component profiler: compiled in only when PROFILER is defined (eg make profiler=true.)
+//when disabled, every profile() hook is discarded at compile-time, and Profiler::Scope is optimized away.
+struct Profiler {
+  #if defined(PROFILER)
+  static constexpr bool enabled = true;
+  #else
+  static constexpr bool enabled = false;
+  #endif
+
+  enum class Section : uint { Refresh, Write, Platform, Count };
+
+  //each scheduler thread owns one set of counters
+  struct Counters {
+    uint64_t nanoseconds = 0;  //host time spent running the thread
+    uint64_t entries = 0;      //number of times the thread was switched to
+    uint64_t switches = 0;     //number of Thread::synchronize() calls that switched to another thread
+    uint64_t clocks = 0;       //emulated clock cycles the thread has advanced
+  };
+
+  //times the enclosing block as one of the per-frame sections
+  struct Scope {
+    Scope(Section section);
+    ~Scope();
+
+  private:
+    Section _section;
+    uint64_t _start;
+  };
+
+  auto reset() -> void;
+  auto attach(Counters&, const char* type) -> void;
+  auto detach(Counters&) -> void;
+  auto enter(Counters*) -> void;
+  auto section(Section, uint64_t nanoseconds) -> void;
+  auto frame() -> void;
+
+  auto node() -> Node::Properties;
+  auto platform(Platform*) -> Platform*;
+  auto text() -> string;
+  auto csv() -> string;
+  auto json() -> string;
+
+private:
+  struct Record {
+    Counters* counters = nullptr;
+    string name;
+  };
+
+  struct Timing {
+    uint64_t nanoseconds = 0;  //total time spent in the section
+    uint64_t calls = 0;        //total number of times the section was entered
+    uint64_t frame = 0;        //time spent in the section during the current frame
+    uint64_t peak = 0;         //most time spent in the section during any one frame
+  };
+
+  static auto name(Section) -> string;
+
+  vector<Record> _records;
+  Timing _sections[(uint)Section::Count];
+  Counters* _active = nullptr;  //nullptr when the host (program) thread is active
+  uint64_t _timestamp = 0;
+  uint64_t _frames = 0;
+  Node::Properties _node;
+};
+
+extern Profiler _profiler;
+
+inline Profiler::Scope::Scope(Section section) {
+  if constexpr(enabled) _section = section, _start = chrono::nanosecond();
+}
+
+inline Profiler::Scope::~Scope() {
+  if constexpr(enabled) _profiler.section(_section, chrono::nanosecond() - _start);
+}
+
+//invokes a profiler hook, eg profile<&Profiler::enter>(counters)
+template<auto function, typename... P>
+inline auto profile(P&&... p) -> void {
+  if constexpr(Profiler::enabled) (_profiler.*function)(forward<P>(p)...);
+}
+
+}
@@ -1,5 +1,9 @@
 inline auto Scheduler::reset() -> void {
+  for(auto& thread : _threads) profile<&Profiler::detach>(thread->_profile);
   _threads.reset();
+  for(auto& timer : _timers) timer->_index = Timer::Inactive;
+  _timers.reset();
+  update();
 }
 
 inline auto Scheduler::threads() const -> uint {
@@ -45,11 +49,67 @@ inline auto Scheduler::append(Thread& thread) -> bool {
   thread._uniqueID = uniqueID();
   thread._clock = maximum() + thread._uniqueID;
   _threads.append(&thread);
+  profile<&Profiler::attach>(thread._profile, typeid(thread).name());
   return true;
 }
 
 inline auto Scheduler::remove(Thread& thread) -> void {
-  _threads.removeByValue(&thread);
+  if(auto index = _threads.find(&thread)) {
+    profile<&Profiler::detach>(thread._profile);
+    _threads.remove(*index);
+  }
+}
+
+//timers are first due one period after the furthest ahead thread.
+inline auto Scheduler::append(Timer& timer) -> bool {
+  if(timer._index != Timer::Inactive) return false;
+  timer._deadline = maximum() + timer._scalar;
+  timer._index = _timers.size();
+  _timers.append(&timer);
+  raise(timer._index);
+  update();
+  return true;
+}
+
+inline auto Scheduler::remove(Timer& timer) -> void {
+  if(timer._index == Timer::Inactive) return;
+  uint index = timer._index;
+  timer._index = Timer::Inactive;
+  auto last = _timers.takeRight();
+  if(last != &timer) {
+    _timers[index] = last;
+    last->_index = index;
+    raise(index);
+    lower(last->_index);
+  }
+  update();
+}
+
+//restores the queue order after a timer deadline was modified (eg by loading a save state.)
+inline auto Scheduler::reschedule(Timer& timer) -> void {
+  if(timer._index == Timer::Inactive) return;
+  raise(timer._index);
+  lower(timer._index);
+  update();
+}
+
+//invokes all timers that are due at or before the given clock time, in deadline order.
+//a timer that has fallen multiple periods behind will be invoked once for each period.
+inline auto Scheduler::service(uintmax clock) -> void {
+  while(_timers && _timers.first()->due() <= clock) {
+    auto timer = _timers.first();
+    timer->advance(clock);
+    if(timer->_index != Timer::Inactive) lower(timer->_index);
+  }
+  update();
+}
+
+//invokes a single timer for each period that has elapsed up to the given clock time.
+inline auto Scheduler::service(Timer& timer, uintmax clock) -> void {
+  if(timer._index == Timer::Inactive) return;
+  timer.advance(clock);
+  if(timer._index != Timer::Inactive) lower(timer._index);
+  update();
 }
 
 //power cycle and soft reset events: assigns the primary thread and resets all thread clocks.
@@ -58,12 +118,18 @@ inline auto Scheduler::power(Thread& thread) -> void {
   for(auto& thread : _threads) {
     thread->_clock = thread->_uniqueID;
   }
+  for(auto& timer : _timers) {
+    timer->_deadline = timer->_scalar;
+  }
+  for(uint index : reverse(range(_timers.size()))) lower(index);
+  update();
 }
 
 inline auto Scheduler::enter(Mode mode) -> Event {
   if(mode == Mode::Run) {
     _mode = mode;
     _host = co_active();
+    profile<&Profiler::enter>(counters(_resume));
     co_switch(_resume);
     platform->event(_event);
     return _event;
@@ -76,6 +142,7 @@ inline auto Scheduler::enter(Mode mode) -> Event {
         _mode = Mode::SynchronizePrimary;
         _host = co_active();
         do {
+          profile<&Profiler::enter>(counters(_resume));
           co_switch(_resume);
           platform->event(_event);
         } while(_event != Event::Synchronize);
@@ -87,6 +154,7 @@ inline auto Scheduler::enter(Mode mode) -> Event {
         _host = co_active();
         _resume = thread->handle();
         do {
+          profile<&Profiler::enter>(counters(_resume));
           co_switch(_resume);
           platform->event(_event);
         } while(_event != Event::Synchronize);
@@ -101,13 +169,23 @@ inline auto Scheduler::enter(Mode mode) -> Event {
 inline auto Scheduler::exit(Event event) -> void {
   //subtract the minimum time from all threads to prevent clock overflow.
   auto reduce = minimum();
+
+  //batched timers are caught up to the point that every thread has reached.
+  for(auto& timer : _timers) timer->advance(reduce);
+  for(uint index : reverse(range(_timers.size()))) lower(index);
+
   for(auto& thread : _threads) {
     thread->_clock -= reduce;
   }
+  for(auto& timer : _timers) {
+    timer->_deadline -= min(reduce, timer->_deadline);
+  }
+  update();
 
   //return to the thread that entered the scheduler originally.
   _event = event;
   _resume = co_active();
+  profile<&Profiler::enter>(nullptr);
   co_switch(_host);
 }
 
@@ -135,3 +213,47 @@ inline auto Scheduler::getSynchronize() -> bool {
 inline auto Scheduler::setSynchronize(bool synchronize) -> void {
   _synchronize = synchronize;
 }
+
+inline auto Scheduler::raise(uint index) -> void {
+  while(index) {
+    uint parent = index - 1 >> 1;
+    if(_timers[parent]->due() <= _timers[index]->due()) break;
+    swap(_timers[parent], _timers[index]);
+    _timers[parent]->_index = parent;
+    _timers[index]->_index = index;
+    index = parent;
+  }
+}
+
+inline auto Scheduler::lower(uint index) -> void {
+  while(true) {
+    uint child = index * 2 + 1;
+    if(child >= _timers.size()) break;
+    if(child + 1 < _timers.size() && _timers[child + 1]->due() < _timers[child]->due()) child++;
+    if(_timers[index]->due() <= _timers[child]->due()) break;
+    swap(_timers[child], _timers[index]);
+    _timers[child]->_index = child;
+    _timers[index]->_index = index;
+    index = child;
+  }
+}
+
+//finds the thread that is currently running, if any.
+inline auto Scheduler::active() const -> Thread* {
+  for(auto& thread : _threads) {
+    if(thread->_handle == co_active()) return thread;
+  }
+  return nullptr;
+}
+
+//used by the profiler to identify the thread being resumed.
+inline auto Scheduler::counters(cothread_t handle) -> Profiler::Counters* {
+  for(auto& thread : _threads) {
+    if(thread->handle() == handle) return &thread->_profile;
+  }
+  return nullptr;
+}
+
+inline auto Scheduler::update() -> void {
+  _deadline = _timers ? _timers.first()->due() : (uintmax)-1;
+}
@@ -1,4 +1,5 @@
 struct Thread;
+struct Timer;
 
 struct Scheduler {
   enum class Mode : uint {
@@ -22,6 +23,12 @@ struct Scheduler {
   auto append(Thread& thread) -> bool;
   auto remove(Thread& thread) -> void;
 
+  auto append(Timer& timer) -> bool;
+  auto remove(Timer& timer) -> void;
+  auto reschedule(Timer& timer) -> void;
+  auto service(uintmax clock) -> void;
+  auto service(Timer& timer, uintmax clock) -> void;
+
   auto power(Thread& thread) -> void;
   auto enter(Mode mode = Mode::Run) -> Event;
   auto exit(Event event) -> void;
@@ -33,15 +40,24 @@ struct Scheduler {
   auto setSynchronize(bool) -> void;
 
 private:
+  auto raise(uint index) -> void;
+  auto lower(uint index) -> void;
+  auto update() -> void;
+  auto active() const -> Thread*;
+  auto counters(cothread_t handle) -> Profiler::Counters*;
+
   cothread_t _host = nullptr;     //program thread (used to exit scheduler)
   cothread_t _resume = nullptr;   //resume thread (used to enter scheduler)
   cothread_t _primary = nullptr;  //primary thread (used to synchronize components)
   Mode _mode = Mode::Run;
   Event _event = Event::Step;
   vector<Thread*> _threads;
+  vector<Timer*> _timers;           //binary min-heap, ordered by deadline plus slack
+  uintmax _deadline = (uintmax)-1;  //time at which the earliest timer must be serviced
   bool _synchronize = false;
 
   friend class Thread;
+  friend class Timer;
 };
 
 extern Scheduler scheduler;
@@ -65,6 +65,10 @@ inline auto Thread::destroy() -> void {
 
 inline auto Thread::step(uint clocks) -> void {
   _clock += _scalar * clocks;
+  if constexpr(Profiler::enabled) _profile.clocks += clocks;
+  //auxiliary threads may run far ahead of the primary thread: were they to service timers, the primary thread
+  //would then observe timer state from its future. auxiliary threads service a timer only when they access it.
+  if(_clock >= scheduler._deadline && _handle == scheduler._primary) scheduler.service(_clock);
 }
 
 //ensure all threads are caught up to the current thread before proceeding.
@@ -77,42 +81,55 @@ inline auto Thread::synchronize() -> void {
 //ensure the specified thread(s) are caught up the current thread before proceeding.
 template<typename... P>
 inline auto Thread::synchronize(Thread& thread, P&&... p) -> void {
+  if constexpr(Profiler::enabled) _profile.switches += thread.clock() < clock() && !scheduler.synchronizing();
   //switching to another thread does not guarantee it will catch up before switching back.
   while(thread.clock() < clock()) {
     //disable synchronization for auxiliary threads during scheduler synchronization.
     //synchronization can begin inside of this while loop.
     if(scheduler.synchronizing()) break;
+    profile<&Profiler::enter>(&thread._profile);
     co_switch(thread.handle());
   }
   //convenience: allow synchronizing multiple threads with one function call.
   if constexpr(sizeof...(p) > 0) synchronize(forward<P>(p)...);
 }
 
+//ensure the specified timer(s) have been serviced up to the current thread before proceeding.
+template<typename... P>
+inline auto Thread::synchronize(Timer& timer, P&&... p) -> void {
+  if(timer._deadline <= clock()) scheduler.service(timer, clock());
+  if constexpr(sizeof...(p) > 0) synchronize(forward<P>(p)...);
+}
+
 inline auto Thread::serialize(serializer& s) -> void {
   s.integer(_frequency);
   s.integer(_scalar);
   s.integer(_clock);
 
   if(!scheduler._synchronize) {
-    static uint8_t stack[Thread::Size];
+    //only the saved registers and the used portion of the stack are stored, when libco can report them.
+    //the region is recorded in the state, so that the entire stack can be stored as a fallback.
     bool resume = co_active() == _handle;
+    uint32_t context = Thread::Size;
+    uint32_t stack = Thread::Size;
 
-    if(s.mode() == serializer::Size) {
-      s.array(stack, Thread::Size);
-      s.boolean(resume);
+    if(s.mode() == serializer::Save && !resume) {
+      uint live[2];
+      if(co_live(_handle, Thread::Size, &live[0], &live[1])) context = live[0], stack = live[1];
     }
 
-    if(s.mode() == serializer::Load) {
-      s.array(stack, Thread::Size);
-      s.boolean(resume);
-      memory::copy(_handle, stack, Thread::Size);
-      if(resume) scheduler._resume = _handle;
+    s.integer(context);
+    s.integer(stack);
+    if(s.mode() == serializer::Load && (context > stack || stack > Thread::Size)) {
+      context = Thread::Size, stack = Thread::Size;
     }
 
-    if(s.mode() == serializer::Save) {
-      memory::copy(stack, _handle, Thread::Size);
-      s.array(stack, Thread::Size);
-      s.boolean(resume);
-    }
+    //size mode must reserve room for the entire stack
+    if(s.mode() == serializer::Size) context = Thread::Size, stack = Thread::Size;
+
+    s.array((uint8_t*)_handle, context);
+    s.array((uint8_t*)_handle + stack, Thread::Size - stack);
+    s.boolean(resume);
+    if(s.mode() == serializer::Load && resume) scheduler._resume = _handle;
   }
 }
@@ -1,4 +1,5 @@
 struct Scheduler;
+struct Timer;
 
 struct Thread {
   enum : uintmax { Second = (uintmax)-1 >> 1 };
@@ -35,6 +36,7 @@ struct Thread {
   auto step(uint clocks) -> void;
   auto synchronize() -> void;
   template<typename... P> auto synchronize(Thread&, P&&...) -> void;
+  template<typename... P> auto synchronize(Timer&, P&&...) -> void;
 
   auto serialize(serializer& s) -> void;
 
@@ -44,6 +46,7 @@ protected:
   uintmax _frequency = 0;
   uintmax _scalar = 0;
   uintmax _clock = 0;
+  Profiler::Counters _profile;
 
   friend class Scheduler;
 };
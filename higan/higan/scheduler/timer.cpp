@@ -0,0 +1,44 @@
+inline Timer::~Timer() {
+  destroy();
+}
+
+inline auto Timer::frequency() const -> uintmax { return _frequency; }
+inline auto Timer::scalar() const -> uintmax { return _scalar; }
+inline auto Timer::deadline() const -> uintmax { return _deadline; }
+
+inline auto Timer::create(double frequency, function<void ()> callback, uint batch) -> void {
+  _frequency = frequency + 0.5;
+  _scalar = Thread::Second / _frequency;
+  _slack = _scalar * (max(1u, batch) - 1);
+  _callback = callback;
+  scheduler.append(*this);
+}
+
+inline auto Timer::destroy() -> void {
+  scheduler.remove(*this);
+}
+
+//services this timer up to the current time of the running thread.
+//this must be called before its owner is accessed, so that the access is applied at the correct time.
+inline auto Timer::synchronize() -> void {
+  if(auto thread = scheduler.active()) {
+    if(_deadline <= thread->clock()) scheduler.service(*this, thread->clock());
+  }
+}
+
+//invokes the callback once for each period that has elapsed up to the given clock time.
+inline auto Timer::advance(uintmax clock) -> void {
+  while(_deadline <= clock) {
+    _deadline += _scalar;
+    _callback();
+  }
+}
+
+inline auto Timer::serialize(serializer& s) -> void {
+  s.integer(_frequency);
+  s.integer(_scalar);
+  s.integer(_deadline);
+
+  //the deadline may have moved relative to the other queued timers
+  if(s.mode() == serializer::Load) scheduler.reschedule(*this);
+}
@@ -0,0 +1,42 @@
+struct Scheduler;
+struct Thread;
+
+//a timer invokes a callback periodically, without the cost of its own cothread.
+//this is intended for components that only need to tick at a fixed rate, such as real-time clocks.
+//timers are kept in a priority queue by the scheduler, and are serviced whenever the primary thread steps past their deadline.
+//a batched timer may fall up to a given number of periods behind before it is serviced; it is then run for all of the
+//periods it is owed at once. its owner calls synchronize() before any access that depends on its state, and all
+//timers are caught up whenever the scheduler exits (eg at the end of each frame.)
+struct Timer {
+  Timer() = default;
+  Timer(const Timer&) = delete;
+  auto operator=(const Timer&) = delete;
+  ~Timer();
+
+  explicit operator bool() const { return _index != Inactive; }
+  auto frequency() const -> uintmax;
+  auto scalar() const -> uintmax;
+  auto deadline() const -> uintmax;
+
+  auto create(double frequency, function<void ()> callback, uint batch = 1) -> void;
+  auto destroy() -> void;
+  auto synchronize() -> void;
+
+  auto serialize(serializer& s) -> void;
+
+protected:
+  enum : uint { Inactive = ~0u };
+
+  auto due() const -> uintmax { return _deadline + _slack; }
+  auto advance(uintmax clock) -> void;
+
+  uint _index = Inactive;  //position within the scheduler queue
+  uintmax _frequency = 0;
+  uintmax _scalar = 0;
+  uintmax _deadline = 0;
+  uintmax _slack = 0;      //time the deadline may be overdue before the timer must be serviced
+  function<void ()> _callback;
+
+  friend class Scheduler;
+  friend class Thread;
+};
@@ -42,7 +42,7 @@ auto APU::main() -> void {
 
 auto APU::step(uint clocks) -> void {
   Thread::step(clocks);
-  Thread::synchronize(cpu, vdp, psg, ym2612);
+  Thread::synchronize(cpu, vdp);
 }
 
 auto APU::setNMI(uint1 value) -> void {
@@ -32,12 +32,12 @@ auto MCD::CDC::decode(int sector) -> void {
     transfer.target  += 2352;
 
     //the sync header is written at the tail instead of head.
-    mcd.fd->seek((abs(mcd.cdd.session.leadIn.lba) + sector) * 2448);
+    auto data = mcd.readAhead.read(sector);
     for(uint index = 0; index <   12; index += 2) {
-      ram[uint13(transfer.pointer + index + 2340 >> 1)] = mcd.fd->readm(2);
+      ram[uint13(transfer.pointer + index + 2340 >> 1)] = data[index] << 8 | data[index + 1];
     }
     for(uint index = 0; index < 2340; index += 2) {
-      ram[uint13(transfer.pointer + index +    0 >> 1)] = mcd.fd->readm(2);
+      ram[uint13(transfer.pointer + index +    0 >> 1)] = data[12 + index] << 8 | data[12 + index + 1];
     }
   }
 }
@@ -72,9 +72,9 @@ auto MCD::CDD::sample() -> void {
   int16 right = 0;
   if(io.status == Status::Playing) {
     if(session.tracks[io.track].isAudio()) {
-      mcd.fd->seek((abs(session.leadIn.lba) + io.sector) * 2448 + io.sample);
-      left  = mcd.fd->readl(2);
-      right = mcd.fd->readl(2);
+      auto sector = mcd.readAhead.read(io.sector);
+      left  = sector[io.sample + 0] << 0 | sector[io.sample + 1] << 8;
+      right = sector[io.sample + 2] << 0 | sector[io.sample + 3] << 8;
       io.sample += 4;
       if(io.sample >= 2352) advance();
     }
@@ -208,6 +208,7 @@ auto MCD::CDD::process() -> void {
     io.latency = 11 + 112.5 * abs(position(io.sector) - position(lba));
     io.sector  = lba;
     io.sample  = 0;
+    mcd.readAhead.seek(lba);
 
     status[1] = 0xf;
     status[2] = 0x0; status[3] = 0x0;
@@ -228,6 +229,7 @@ auto MCD::CDD::process() -> void {
     io.latency = 11 + 112.5 * abs(position(io.sector) - position(lba));
     io.sector  = lba;
     io.sample  = 0;
+    mcd.readAhead.seek(lba);
 
     status[1] = 0xf;
     status[2] = 0x0; status[3] = 0x0;
@@ -266,6 +268,7 @@ auto MCD::CDD::checksum() -> void {
 }
 
 auto MCD::CDD::insert() -> void {
+  mcd.readAhead.unload();
   if(!mcd.disc || !mcd.fd) {
     io.status = Status::NoDisc;
     return;
@@ -279,6 +282,7 @@ auto MCD::CDD::insert() -> void {
     mcd.fd->read(sub.data() + sector * 96, 96);
   }
   session.decode(sub, 96);
+  mcd.readAhead.load(mcd.fd, abs(session.leadIn.lba));
 
   io.status = Status::ReadingTOC;
   io.sector = session.leadIn.lba;
@@ -287,6 +291,7 @@ auto MCD::CDD::insert() -> void {
 }
 
 auto MCD::CDD::eject() -> void {
+  mcd.readAhead.unload();
   session = {};
 
   io.status = Status::NoDisc;
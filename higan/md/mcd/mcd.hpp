@@ -5,6 +5,7 @@ struct MCD : M68K, Thread {
   Node::Port tray;
   Node::Peripheral disc;
   Shared::File fd;
+  CDPrefetch readAhead;
   Memory::Readable<uint16> bios;  //BIOS ROM
   Memory::Writable<uint16> pram;  //program RAM
   Memory::Writable<uint16> wram;  //work RAM
@@ -6,6 +6,7 @@
 #include <component/processor/m68k/m68k.hpp>
 #include <component/processor/z80/z80.hpp>
 #include <component/audio/sn76489/sn76489.hpp>
+#include <component/cd/prefetch/prefetch.hpp>
 
 namespace higan::MegaDrive {
   #include <higan/inline.hpp>
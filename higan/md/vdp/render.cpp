@@ -8,7 +8,12 @@ auto VDP::scanline() -> void {
 
   if(state.vcounter == 240) scheduler.exit(Event::Frame);
 
-  state.output = output + (state.vcounter * 2 + 0) * 1280;
+  if(state.vcounter < 240) widths[state.vcounter] = screenWidth();
+  if(!latch.interlace) {
+    state.output = output + state.vcounter * 320;
+  } else {
+    state.output = output + (state.vcounter * 2 + state.field) * 320;
+  }
 }
 
 auto VDP::run() -> void {
@@ -49,16 +54,5 @@ auto VDP::run() -> void {
 }
 
 auto VDP::outputPixel(uint32 color) -> void {
-  uint32* field[2] = {&state.output[0], &state.output[1280]};
-  if(!io.interlaceMode.bit(0)) {
-    for(auto n : range(pixelWidth())) {
-      field[0][n] = color;
-      field[1][n] = color;
-    }
-  } else {
-    for(auto n : range(pixelWidth())) {
-      field[state.field][n] = color;
-    }
-  }
-  state.output += pixelWidth();
+  *state.output++ = color;
 }
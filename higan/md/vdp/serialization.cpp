@@ -35,6 +35,7 @@ auto VDP::serialize(serializer& s) -> void {
   s.integer(io.dataIncrement);
 
   s.integer(latch.overscan);
+  s.integer(latch.interlace);
   s.integer(latch.horizontalInterruptCounter);
   s.integer(latch.displayWidth);
 
@@ -18,13 +18,13 @@ auto VDP::load(Node::Object parent) -> void {
 
   screen = node->append<Node::Screen>("Screen");
   screen->colors(3 * (1 << 9), {&VDP::color, this});
-  screen->setSize(1280, 480);
-  screen->setScale(0.25, 0.50);
+  screen->setSize(320, 240);
+  screen->setScale(1.0, 1.0);
   screen->setAspect(1.0, 1.0);
 
   overscan = screen->append<Node::Boolean>("Overscan", true, [&](auto value) {
-    if(value == 0) screen->setSize(1280, 448);
-    if(value == 1) screen->setSize(1280, 480);
+    if(value == 0) screen->setSize(320, 224);
+    if(value == 1) screen->setSize(320, 240);
   });
   overscan->setDynamic(true);
 
@@ -87,6 +87,7 @@ auto VDP::main() -> void {
     state.vcounter = 0;
     state.field ^= 1;
     latch.overscan = io.overscan;
+    latch.interlace = io.interlaceMode == 3;
   }
   latch.displayWidth = io.displayWidth;
 }
@@ -100,24 +101,47 @@ auto VDP::step(uint clocks) -> void {
   }
 }
 
+//frames are output at their native width and a single field per frame (two in interlace mode 2);
+//scaling to the display size is left to the video driver.
 auto VDP::refresh() -> void {
-  auto data = output;
+  uint interlace = latch.interlace;
+  uint lines = overscan->value() ? 240 : 224;
+  int top = 0;  //first line of the frame that is displayed
+  if(overscan->value() == 0 &&  latch.overscan) top = +8;
+  if(overscan->value() == 1 && !latch.overscan) top = -8;
+  auto data = output + top * (320 << interlace);
+
+  uint width = 0;
+  bool uniform = true;
+  for(int line = max(0, top); line < top + (int)lines && line < (int)screenHeight(); line++) {
+    if(!width) width = widths[line];
+    if(widths[line] != width) uniform = false;
+  }
+  if(!width) width = screenWidth();
 
-  if(overscan->value() == 0) {
-    if(latch.overscan) data += 16 * 1280;
-    screen->refresh(data, 1280 * sizeof(uint32), 1280, 448);
+  if(uniform) {
+    return screen->refresh(data, 320 * sizeof(uint32), width, lines << interlace);
   }
 
-  if(overscan->value() == 1) {
-    if(!latch.overscan) data -= 16 * 1280;
-    screen->refresh(data, 1280 * sizeof(uint32), 1280, 480);
+  //the display width changed mid-frame: expand every line to the common multiple of both widths
+  mixed.resize(1280 * (lines << interlace));
+  for(uint y : range(lines << interlace)) {
+    int line = top + (y >> interlace);
+    uint lineWidth = line >= 0 && line < (int)screenHeight() ? (uint)widths[line] : 320;
+    uint scale = 1280 / lineWidth;
+    auto source = data + y * 320;
+    auto target = mixed.data() + y * 1280;
+    for(uint x : range(lineWidth)) {
+      for(uint n : range(scale)) *target++ = source[x];
+    }
   }
+  screen->refresh(mixed.data(), 1280 * sizeof(uint32), 1280, lines << interlace);
 }
 
 auto VDP::power(bool reset) -> void {
   Thread::create(system.frequency() / 2.0, {&VDP::main, this});
 
-  output = buffer + 16 * 1280;  //overscan offset
+  output = buffer + 16 * 320;  //overscan offset
 
   if(!reset) {
     for(auto& data : vram.memory) data = 0;
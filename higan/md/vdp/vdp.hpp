@@ -265,6 +265,7 @@ private:
   struct Latch {
     //per-frame
     uint1 overscan;
+    uint1 interlace;  //interlace mode 2: both fields are woven into one 448/480-line frame
     uint8 horizontalInterruptCounter;
 
     //per-scanline
@@ -279,8 +280,11 @@ private:
      uint1 field;
   } state;
 
-  uint32 buffer[1280 * 512];
+  //frames are rendered at their native width (256 or 320 dots per line)
+  uint32 buffer[320 * 512];
   uint32* output = nullptr;
+  uint16 widths[240];    //width of each line of the current frame
+  vector<uint32> mixed;  //frames that change width mid-frame are expanded to 1280 dots per line
 
   friend class Interface;
 };
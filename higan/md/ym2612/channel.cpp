@@ -26,10 +26,14 @@ auto YM2612::Channel::Operator::trigger(bool state) -> void {
   updateLevel();
 }
 
-auto YM2612::Channel::Operator::runEnvelope() -> void {
-  uint sustain = envelope.sustainLevel < 15 ? envelope.sustainLevel << 5 : 0x3f0;
+//the common cases are inlined into YM2612::main(): most envelopes do not step on a given clock, and SSG is rarely enabled
+alwaysinline auto YM2612::Channel::Operator::runEnvelope() -> void {
   if(ym2612.envelope.clock & (1 << envelope.divider) - 1) return;
+  stepEnvelope();
+}
 
+auto YM2612::Channel::Operator::stepEnvelope() -> void {
+  uint sustain = envelope.sustainLevel < 15 ? envelope.sustainLevel << 5 : 0x3f0;
   uint value = ym2612.envelope.clock >> envelope.divider;
   uint step = envelope.steps >> ((~value & 7) << 2) & 0xf;
   if(ssg.enable) step <<= 2;  //SSG results in a 4x faster envelope
@@ -54,10 +58,12 @@ auto YM2612::Channel::Operator::runEnvelope() -> void {
   updateLevel();
 }
 
-auto YM2612::Channel::Operator::runPhase() -> void {
+alwaysinline auto YM2612::Channel::Operator::runPhase() -> void {
   phase.value += phase.delta;  //advance wave position
-  if(!(ssg.enable && envelope.value >= 0x200)) return;  //SSG loop check
+  if(ssg.enable && envelope.value >= 0x200) runSSG();  //SSG loop check
+}
 
+auto YM2612::Channel::Operator::runSSG() -> void {
   if(!ssg.hold && !ssg.alternate) phase.value = 0;
   if(!ssg.hold || ssg.attack == ssg.invert) ssg.invert ^= ssg.alternate;
 
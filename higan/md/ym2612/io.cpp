@@ -1,4 +1,5 @@
 auto YM2612::readStatus() -> uint8 {
+  Timer::synchronize();
   //d7 = busy (not emulated, requires cycle timing accuracy)
   return timerA.line << 0 | timerB.line << 1;
 }
@@ -8,6 +9,7 @@ auto YM2612::writeAddress(uint9 data) -> void {
 }
 
 auto YM2612::writeData(uint8 data) -> void {
+  Timer::synchronize();
   switch(io.address) {
 
   //LFO
@@ -149,6 +151,7 @@ auto YM2612::writeData(uint8 data) -> void {
     op.ssg.alternate = data.bit(1);
     op.ssg.attack = data.bit(2);
     op.ssg.enable = data.bit(3);
+    op.updateLevel();
     break;
   }
 
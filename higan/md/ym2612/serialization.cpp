@@ -1,5 +1,5 @@
 auto YM2612::serialize(serializer& s) -> void {
-  Thread::serialize(s);
+  Timer::serialize(s);
 
   s.integer(io.address);
 
@@ -22,6 +22,7 @@ auto YM2612::load(Node::Object parent) -> void {
 auto YM2612::unload() -> void {
   node = {};
   stream = {};
+  Timer::destroy();
 }
 
 auto YM2612::main() -> void {
@@ -33,10 +34,11 @@ auto YM2612::main() -> void {
   if(lfo.enable && ++lfo.divider == lfoDividers[lfo.rate]) {
     lfo.divider = 0;
     lfo.clock++;
+    //only operators modulated by the LFO need updating: the others are refreshed by the register writes that affect them
     for(auto& channel : channels) {
       for(auto& op : channel.operators) {
-        op.updatePhase();  //due to vibrato
-        op.updateLevel();  //due to tremolo
+        if(channel.vibrato) op.updatePhase();
+        if(op.lfoEnable) op.updateLevel();
       }
     }
   }
@@ -46,15 +48,14 @@ auto YM2612::main() -> void {
     envelope.clock++;
   }
 
+  //operators are independent of one another: each generator is run for all of them in turn
   for(auto& channel : channels) {
-    for(auto& op : channel.operators) {
-      op.runPhase();
-      if(envelope.divider) continue;
-      op.runEnvelope();
-    }
+    for(auto& op : channel.operators) op.runPhase();
+  }
+  if(envelope.divider) return;
+  for(auto& channel : channels) {
+    for(auto& op : channel.operators) op.runEnvelope();
   }
-
-  step(144);
 }
 
 auto YM2612::sample() -> void {
@@ -159,13 +160,9 @@ auto YM2612::sample() -> void {
   stream->sample(sclamp<16>(left) / 32768.0, sclamp<16>(right) / 32768.0);
 }
 
-auto YM2612::step(uint clocks) -> void {
-  Thread::step(clocks);
-  Thread::synchronize(cpu, apu);
-}
-
 auto YM2612::power(bool reset) -> void {
-  Thread::create(system.frequency() / 7.0, {&YM2612::main, this});
+  Timer::synchronize();
+  Timer::create(system.frequency() / 7.0 / 144.0, {&YM2612::main, this}, 64);
 
   io = {};
   lfo = {};
@@ -1,7 +1,7 @@
 //Yamaha YM2612
 //Author: Talarubi
 
-struct YM2612 : Thread {
+struct YM2612 : Timer {
   Node::Component node;
   Node::Stream stream;
 
@@ -11,7 +11,6 @@ struct YM2612 : Thread {
 
   auto main() -> void;
   auto sample() -> void;
-  auto step(uint clocks) -> void;
 
   auto power(bool reset) -> void;
 
@@ -95,7 +94,9 @@ private:
       auto trigger(bool) -> void;
 
       auto runEnvelope() -> void;
+      auto stepEnvelope() -> void;
       auto runPhase() -> void;
+      auto runSSG() -> void;
 
       auto updateEnvelope() -> void;
       auto updatePitch() -> void;
@@ -17,22 +17,22 @@ auto OPLL::load(Node::Object parent) -> void {
 auto OPLL::unload() -> void {
   node = {};
   stream = {};
+  Timer::destroy();
 }
 
 auto OPLL::main() -> void {
   auto output = YM2413::clock();
   stream->sample(output);
-  step(1);
 }
 
-auto OPLL::step(uint clocks) -> void {
-  Thread::step(clocks);
-  Thread::synchronize(cpu);
+auto OPLL::write(uint8 data) -> void {
+  Timer::synchronize();
+  YM2413::write(data);
 }
 
 auto OPLL::power() -> void {
   YM2413::power();
-  Thread::create(system.colorburst() / 72.0, {&OPLL::main, this});
+  Timer::create(system.colorburst() / 72.0, {&OPLL::main, this}, 64);
 }
 
 }
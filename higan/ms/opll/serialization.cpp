@@ -1,4 +1,4 @@
 auto OPLL::serialize(serializer& s) -> void {
   YM2413::serialize(s);
-  Thread::serialize(s);
+  Timer::serialize(s);
 }
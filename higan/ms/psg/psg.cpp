@@ -17,6 +17,7 @@ auto PSG::load(Node::Object parent) -> void {
 auto PSG::unload() -> void {
   node = {};
   stream = {};
+  Timer::destroy();
 }
 
 auto PSG::main() -> void {
@@ -47,24 +48,23 @@ auto PSG::main() -> void {
 
     stream->sample(left / 4.0, right / 4.0);
   }
-
-  step(1);
 }
 
-auto PSG::step(uint clocks) -> void {
-  Thread::step(clocks);
-  Thread::synchronize(cpu);
+auto PSG::write(uint8 data) -> void {
+  Timer::synchronize();
+  SN76489::write(data);
 }
 
 auto PSG::balance(uint8 data) -> void {
   if(Model::GameGear()) {
+    Timer::synchronize();
     io.enable = data;
   }
 }
 
 auto PSG::power() -> void {
   SN76489::power();
-  Thread::create(system.colorburst() / 16.0, {&PSG::main, this});
+  Timer::create(system.colorburst() / 16.0, {&PSG::main, this}, 256);
 
   io = {};
   for(uint level : range(15)) {
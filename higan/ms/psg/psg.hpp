@@ -1,4 +1,4 @@
-struct PSG : SN76489, Thread {
+struct PSG : SN76489, Timer {
   Node::Component node;
   Node::Stream stream;
 
@@ -7,7 +7,7 @@ struct PSG : SN76489, Thread {
   auto unload() -> void;
 
   auto main() -> void;
-  auto step(uint clocks) -> void;
+  auto write(uint8 data) -> void;
   auto balance(uint8 data) -> void;
   auto power() -> void;
 
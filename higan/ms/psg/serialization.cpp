@@ -1,5 +1,5 @@
 auto PSG::serialize(serializer& s) -> void {
   SN76489::serialize(s);
-  Thread::serialize(s);
+  Timer::serialize(s);
   s.integer(io.enable);
 }
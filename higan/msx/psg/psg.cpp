@@ -17,6 +17,7 @@ auto PSG::load(Node::Object parent) -> void {
 auto PSG::unload() -> void {
   node = {};
   stream = {};
+  Timer::destroy();
 }
 
 auto PSG::main() -> void {
@@ -26,17 +27,16 @@ auto PSG::main() -> void {
   output += volume[channels[1]];
   output += volume[channels[2]];
   stream->sample(output / 3.0);
-  step(1);
 }
 
-auto PSG::step(uint clocks) -> void {
-  Thread::step(clocks);
-  Thread::synchronize(cpu);
+auto PSG::write(uint8 data) -> void {
+  Timer::synchronize();
+  AY38910::write(data);
 }
 
 auto PSG::power() -> void {
   AY38910::power();
-  Thread::create(system.colorburst() / 16.0, {&PSG::main, this});
+  Timer::create(system.colorburst() / 16.0, {&PSG::main, this}, 256);
 
   for(uint level : range(16)) {
     volume[level] = 1.0 / pow(2, 1.0 / 2 * (15 - level));
@@ -1,4 +1,4 @@
-struct PSG : AY38910, Thread {
+struct PSG : AY38910, Timer {
   Node::Component node;
   Node::Stream stream;
 
@@ -7,7 +7,7 @@ struct PSG : AY38910, Thread {
   auto unload() -> void;
 
   auto main() -> void;
-  auto step(uint clocks) -> void;
+  auto write(uint8 data) -> void;
   auto power() -> void;
 
   auto readIO(uint1 port) -> uint8 override;
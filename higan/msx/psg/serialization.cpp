@@ -1,4 +1,4 @@
 auto PSG::serialize(serializer& s) -> void {
   AY38910::serialize(s);
-  Thread::serialize(s);
+  Timer::serialize(s);
 }
@@ -51,7 +51,7 @@ auto APU::main() -> void {
 
 auto APU::step(uint clocks) -> void {
   Thread::step(clocks);
-  Thread::synchronize(cpu, psg);
+  Thread::synchronize(cpu);
 }
 
 auto APU::power() -> void {
@@ -17,6 +17,7 @@ auto PSG::load(Node::Object parent) -> void {
 auto PSG::unload() -> void {
   node = {};
   stream = {};
+  Timer::destroy();
 }
 
 auto PSG::main() -> void {
@@ -41,33 +42,40 @@ auto PSG::main() -> void {
   }
 
   stream->sample(left, right);
-  step(1);
 }
 
-auto PSG::step(uint clocks) -> void {
-  Thread::step(clocks);
-  synchronize(cpu);
-  synchronize(apu);
+auto PSG::writeLeft(uint8 data) -> void {
+  Timer::synchronize();
+  T6W28::writeLeft(data);
+}
+
+auto PSG::writeRight(uint8 data) -> void {
+  Timer::synchronize();
+  T6W28::writeRight(data);
 }
 
 auto PSG::enablePSG() -> void {
+  Timer::synchronize();
   psg.enable = 1;
 }
 
 auto PSG::enableDAC() -> void {
+  Timer::synchronize();
   psg.enable = 0;
 }
 
 auto PSG::writeLeftDAC(uint8 data) -> void {
+  Timer::synchronize();
   dac.left  = data;
 }
 
 auto PSG::writeRightDAC(uint8 data) -> void {
+  Timer::synchronize();
   dac.right = data;
 }
 
 auto PSG::power() -> void {
-  Thread::create(system.frequency() / 32.0, {&PSG::main, this});
+  Timer::create(system.frequency() / 32.0, {&PSG::main, this}, 256);
 
   psg = {};
   dac = {};
@@ -1,4 +1,4 @@
-struct PSG : T6W28, Thread {
+struct PSG : T6W28, Timer {
   Node::Component node;
   Node::Stream stream;
 
@@ -7,7 +7,8 @@ struct PSG : T6W28, Thread {
   auto unload() -> void;
 
   auto main() -> void;
-  auto step(uint clocks) -> void;
+  auto writeLeft(uint8 data) -> void;
+  auto writeRight(uint8 data) -> void;
   auto enablePSG() -> void;
   auto enableDAC() -> void;
   auto writeLeftDAC(uint8 data) -> void;
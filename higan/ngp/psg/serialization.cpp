@@ -1,6 +1,6 @@
 auto PSG::serialize(serializer& s) -> void {
   T6W28::serialize(s);
-  Thread::serialize(s);
+  Timer::serialize(s);
 
   s.integer(psg.enable);
   s.integer(dac.left);
@@ -9,18 +9,21 @@ auto PCD::Drive::seekRead() -> void {
   mode = Mode::Seeking;
   seek = Mode::Reading;
   latency = distance();
+  pcd.readAhead.seek(start);
 }
 
 auto PCD::Drive::seekPlay() -> void {
   mode = Mode::Seeking;
   seek = Mode::Playing;
   latency = distance();
+  pcd.readAhead.seek(start);
 }
 
 auto PCD::Drive::seekPause() -> void {
   mode = Mode::Seeking;
   seek = Mode::Paused;
   latency = distance();
+  pcd.readAhead.seek(start);
 }
 
 auto PCD::Drive::read() -> bool {
@@ -32,8 +35,7 @@ auto PCD::Drive::read() -> bool {
 
 //print("* ", reading() ? "data" : "cdda", " read ", lba, " to ", end - 1, "\n");
 
-  pcd.fd->seek(2448 * (abs(session->leadIn.lba) + lba));
-  pcd.fd->read(sector, 2448);
+  memory::copy(sector, pcd.readAhead.read(lba), 2448);
   if(++lba == end) setInactive();
   return true;
 }
@@ -89,9 +89,11 @@ auto PCD::connect() -> void {
     fd->read(subchannel.data() + sector * 96, 96);
   }
   session.decode(subchannel, 96);
+  readAhead.load(fd, abs(session.leadIn.lba));
 }
 
 auto PCD::disconnect() -> void {
+  readAhead.unload();
   disc = {};
   fd = {};
 }
@@ -5,6 +5,7 @@ struct PCD : Thread {
   Node::Port tray;
   Node::Peripheral disc;
   Shared::File fd;
+  CDPrefetch readAhead;
   CD::Session session;
   Memory::Writable<uint8> wram;  // 64KB
   Memory::Writable<uint8> bram;  //  2KB
@@ -5,6 +5,7 @@
 
 #include <component/processor/huc6280/huc6280.hpp>
 #include <component/audio/msm5205/msm5205.hpp>
+#include <component/cd/prefetch/prefetch.hpp>
 
 namespace higan::PCEngine {
   #include <higan/inline.hpp>
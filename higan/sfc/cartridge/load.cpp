@@ -113,13 +113,13 @@ auto Cartridge::loadMap(
 //memory(type=ROM,content=Program)
 auto Cartridge::loadROM(Markup::Node node) -> void {
   loadMemory(rom, node, File::Required);
-  for(auto leaf : node.find("map")) loadMap(leaf, rom);
+  for(auto leaf : node.find("map")) bus.direct(loadMap(leaf, rom), rom.data());
 }
 
 //memory(type=RAM,content=Save)
 auto Cartridge::loadRAM(Markup::Node node) -> void {
   loadMemory(ram, node, File::Optional);
-  for(auto leaf : node.find("map")) loadMap(leaf, ram);
+  for(auto leaf : node.find("map")) bus.direct(loadMap(leaf, ram), ram.data());
 }
 
 //processor(identifier=ICD)
@@ -26,13 +26,13 @@ auto Competition::unload() -> void {
   rom[1].reset();
   rom[2].reset();
   rom[3].reset();
-  cpu.coprocessors.removeByValue(this);
+  cpu.deferred.removeByValue(this);
   Thread::destroy();
 }
 
 auto Competition::power() -> void {
   Thread::create(1, {&Competition::main, this});
-  cpu.coprocessors.append(this);
+  cpu.deferred.append(this);
 
   //DIP switches 0-3 control the time: 3 minutes + 0-15 extra minutes
   timer = (3 + dip.value.bit(0,3)) * 60;  //in seconds
@@ -87,6 +87,7 @@ auto Competition::mcuWrite(uint24 address, uint8 data) -> void {
 }
 
 auto Competition::read(uint24 address, uint8 data) -> uint8 {
+  cpu.synchronize(*this);
   if(address == 0x106000 || address == 0xc00000) {
     return status;
   }
@@ -94,6 +95,7 @@ auto Competition::read(uint24 address, uint8 data) -> uint8 {
 }
 
 auto Competition::write(uint24 address, uint8 data) -> void {
+  cpu.synchronize(*this);
   if(address == 0x206000 || address == 0xe00000) {
     select = data;
     if(timer && data == 0x09) {
@@ -21,9 +21,6 @@ auto EpsonRTC::main() -> void {
     if(seconds % 1440 == 0) irq(3), seconds = 0;  //1 hour
     tick();
   }
-
-  Thread::step(1);
-  Thread::synchronize(cpu);
 }
 
 auto EpsonRTC::initialize() -> void {
@@ -68,13 +65,11 @@ auto EpsonRTC::initialize() -> void {
 }
 
 auto EpsonRTC::unload() -> void {
-  cpu.coprocessors.removeByValue(this);
-  Thread::destroy();
+  Timer::destroy();
 }
 
 auto EpsonRTC::power() -> void {
-  Thread::create(32'768 * 64, {&EpsonRTC::main, this});
-  cpu.coprocessors.append(this);
+  Timer::create(32'768 * 64, {&EpsonRTC::main, this});
 
   clocks = 0;
   seconds = 0;
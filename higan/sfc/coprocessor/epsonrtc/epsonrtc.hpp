@@ -1,11 +1,9 @@
 //Epson RTC-4513 Real-Time Clock
 
-struct EpsonRTC : Thread {
+struct EpsonRTC : Timer {
   Node::RealTimeClock rtc;
   auto load(Node::Object) -> void;
 
-  using Thread::synchronize;
-
   auto main() -> void;
 
   auto initialize() -> void;
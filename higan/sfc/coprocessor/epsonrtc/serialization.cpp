@@ -1,5 +1,5 @@
 auto EpsonRTC::serialize(serializer& s) -> void {
-  Thread::serialize(s);
+  Timer::serialize(s);
 
   s.integer(clocks);
   s.integer(seconds);
@@ -20,7 +20,7 @@ auto ICD::load(Node::Peripheral parent) -> void {
 auto ICD::unload() -> void {
   GameBoy::SuperGameBoyInterface::unload();
 
-  cpu.coprocessors.removeByValue(this);
+  cpu.deferred.removeByValue(this);
   Thread::destroy();
 }
 
@@ -43,7 +43,7 @@ auto ICD::power(bool reset) -> void {
       main();
     }
   });
-  cpu.coprocessors.append(this);
+  cpu.deferred.append(this);
 
   for(auto& packet : this->packet) packet = {};
   packetSize = 0;
@@ -1,4 +1,5 @@
 auto ICD::readIO(uint24 address, uint8 data) -> uint8 {
+  cpu.synchronize(*this);
   address &= 0x40ffff;
 
   //LY counter
@@ -37,6 +38,7 @@ auto ICD::readIO(uint24 address, uint8 data) -> uint8 {
 }
 
 auto ICD::writeIO(uint24 address, uint8 data) -> void {
+  cpu.synchronize(*this);
   address &= 0xffff;
 
   //VRAM port
@@ -1,38 +1,57 @@
 MSU1 msu1;
+#include "reader.cpp"
 #include "serialization.cpp"
 
 auto MSU1::load(Node::Object parent) -> void {
   stream = parent->append<Node::Stream>("MSU1");
   stream->setChannels(2);
   stream->setFrequency(44100);
+
+  running = true;
+  signaled = false;
+  thread = nall::thread::create([&](uintptr) { worker(); });
 }
 
 auto MSU1::unload() -> void {
+  lock.lock();
+  running = false;
+  lock.unlock();
+  wake.notify_one();
+  thread.join();
+  dataReader.close();
+  audioReader.close();
+
   stream = {};
-  dataFile = {};
-  audioFile = {};
 
-  cpu.coprocessors.removeByValue(this);
-  Thread::destroy();
+  Timer::destroy();
 }
 
 auto MSU1::main() -> void {
+  update();
+
   double left  = 0.0;
   double right = 0.0;
 
   if(io.audioPlay) {
-    if(audioFile) {
-      if(audioFile->end()) {
+    audioReader.wait();
+    if(audioReader.valid()) {
+      if(io.audioPlayOffset >= audioReader.size()) {
         if(!io.audioRepeat) {
           io.audioPlay = false;
-          audioFile->seek(io.audioPlayOffset = 8);
+          audioReader.seek(io.audioPlayOffset = 8);
         } else {
-          audioFile->seek(io.audioPlayOffset = io.audioLoopOffset);
+          //the reader has already wrapped around to the loop offset
+          io.audioPlayOffset = io.audioLoopOffset;
         }
       } else {
         io.audioPlayOffset += 4;
-        left  = (double)(int16)audioFile->readl(2) / 32768.0 * (double)io.audioVolume / 255.0;
-        right = (double)(int16)audioFile->readl(2) / 32768.0 * (double)io.audioVolume / 255.0;
+        auto sample = [&]() -> double {
+          uint16 data = audioReader.read();
+          data |= audioReader.read() << 8;
+          return (double)(int16)data / 32768.0 * (double)io.audioVolume / 255.0;
+        };
+        left  = sample();
+        right = sample();
         if(dsp.mute()) left = 0, right = 0;
       }
     } else {
@@ -41,13 +60,10 @@ auto MSU1::main() -> void {
   }
 
   stream->sample(left, right);
-  Thread::step(1);
-  Thread::synchronize(cpu);
 }
 
 auto MSU1::power() -> void {
-  Thread::create(44100, {&MSU1::main, this});
-  cpu.coprocessors.append(this);
+  Timer::create(44100, {&MSU1::main, this});
 
   io.dataSeekOffset = 0;
   io.dataReadOffset = 0;
@@ -69,37 +85,39 @@ auto MSU1::power() -> void {
 
   dataOpen();
   audioOpen();
+  dataReader.wait();
+  audioReader.wait();
+  update();
 }
 
+//opens and seeks complete asynchronously: the busy flags are cleared by update() once the worker has finished.
 auto MSU1::dataOpen() -> void {
-  dataFile.reset();
   string name = {"msu1/data.rom"};
-  if(dataFile = platform->open(cartridge.node, name, File::Read)) {
-    dataFile->seek(io.dataReadOffset);
-  }
+  io.dataBusy = true;
+  dataReader.open(platform->open(cartridge.node, name, File::Read), io.dataReadOffset, false);
 }
 
 auto MSU1::audioOpen() -> void {
-  audioFile.reset();
   string name = {"msu1/track-", io.audioTrack, ".pcm"};
-  if(audioFile = platform->open(cartridge.node, name, File::Read)) {
-    if(audioFile->size() >= 8) {
-      uint32 header = audioFile->readm(4);
-      if(header == 0x4d535531) {  //"MSU1"
-        io.audioLoopOffset = 8 + audioFile->readl(4) * 4;
-        if(io.audioLoopOffset > audioFile->size()) io.audioLoopOffset = 8;
-        io.audioError = false;
-        audioFile->seek(io.audioPlayOffset);
-        return;
-      }
-    }
-    audioFile.reset();
+  io.audioBusy = true;
+  audioReader.open(platform->open(cartridge.node, name, File::Read), io.audioPlayOffset, true);
+}
+
+auto MSU1::update() -> void {
+  if(io.dataBusy && dataReader.ready()) {
+    io.dataBusy = false;
+  }
+
+  if(io.audioBusy && audioReader.ready()) {
+    io.audioBusy = false;
+    io.audioError = !audioReader.valid();
+    if(audioReader.valid()) io.audioLoopOffset = audioReader.loopOffset();
   }
-  io.audioError = true;
 }
 
 auto MSU1::readIO(uint24 address, uint8 data) -> uint8 {
   cpu.synchronize(*this);
+  update();
 
   switch(0x2000 | address & 7) {
   case 0x2000:
@@ -112,10 +130,10 @@ auto MSU1::readIO(uint24 address, uint8 data) -> uint8 {
     return data;
   case 0x2001:
     if(io.dataBusy) return 0x00;
-    if(!dataFile) return 0x00;
-    if(dataFile->end()) return 0x00;
+    if(!dataReader.valid()) return 0x00;
+    if(io.dataReadOffset >= dataReader.size()) return 0x00;
     io.dataReadOffset++;
-    return dataFile->read();
+    return dataReader.read();
   case 0x2002: return 'S';
   case 0x2003: return '-';
   case 0x2004: return 'M';
@@ -129,6 +147,7 @@ auto MSU1::readIO(uint24 address, uint8 data) -> uint8 {
 
 auto MSU1::writeIO(uint24 address, uint8 data) -> void {
   cpu.synchronize(*this);
+  update();
 
   switch(0x2000 | address & 7) {
   case 0x2000: io.dataSeekOffset.byte(0) = data; break;
@@ -136,7 +155,8 @@ auto MSU1::writeIO(uint24 address, uint8 data) -> void {
   case 0x2002: io.dataSeekOffset.byte(2) = data; break;
   case 0x2003: io.dataSeekOffset.byte(3) = data;
     io.dataReadOffset = io.dataSeekOffset;
-    if(dataFile) dataFile->seek(io.dataReadOffset);
+    io.dataBusy = true;
+    dataReader.seek(io.dataReadOffset);
     break;
   case 0x2004: io.audioTrack.byte(0) = data; break;
   case 0x2005: io.audioTrack.byte(1) = data;
@@ -1,7 +1,62 @@
-struct MSU1 : Thread {
+struct MSU1 : Timer {
   Node::Stream stream;
-  Shared::File dataFile;
-  Shared::File audioFile;
+
+  //reader.cpp
+  //files are read and seeked on a worker thread, which keeps a read-ahead ring for each stream.
+  //the emulation thread only opens files and consumes buffered bytes.
+  struct Reader {
+    enum : uint { Capacity = 64 * 1024 };  //bytes buffered ahead of the read position (must be a power of two)
+    enum : uint { Preload  = 16 * 1024 };  //bytes buffered before an open or seek is reported as completed
+    enum : uint { Chunk    =  4 * 1024 };  //bytes read by the worker at a time
+
+    auto open(Shared::File file, uint32 offset, bool audio) -> void;
+    auto seek(uint32 offset) -> void;
+    auto close() -> void;
+    auto ready() const -> bool { return completed.load(std::memory_order_acquire) == requested; }
+    auto wait() -> void;
+    auto read() -> uint8;
+
+    //only valid once ready()
+    auto valid() const -> bool { return result.valid; }
+    auto size() const -> uint32 { return result.size; }
+    auto loopOffset() const -> uint32 { return result.loopOffset; }
+
+    //called from the worker thread
+    auto service() -> bool;
+
+  private:
+    auto fill(uint bytes) -> void;
+    auto publish() -> void;
+
+    //written by the emulation thread under lock
+    std::mutex lock;
+    std::condition_variable filled;  //signaled when a request has completed, or more bytes were buffered
+    Shared::File pending;
+    bool replace = false;
+    bool audio = false;
+    uint32 offset;
+    uint32 requested;
+
+    //owned by the worker thread
+    Shared::File file;
+    uint32 served;
+    uint32 position;
+    bool looping = false;
+    struct Result {
+      bool valid = false;
+      uint32 size;
+      uint32 loopOffset;
+    } result;
+
+    //shared between both threads
+    std::atomic<bool> streaming{false};
+    std::atomic<uint32_t> completed{0};
+    std::atomic<uint64_t> head{0};  //bytes written into the ring by the worker
+    std::atomic<uint64_t> tail{0};  //bytes consumed from the ring by the emulation thread
+    uint8_t ring[Capacity];
+  };
+  Reader dataReader;
+  Reader audioReader;
 
   auto load(Node::Object) -> void;
   auto unload() -> void;
@@ -11,6 +66,7 @@ struct MSU1 : Thread {
 
   auto dataOpen() -> void;
   auto audioOpen() -> void;
+  auto update() -> void;
 
   auto readIO(uint24 address, uint8 data) -> uint8;
   auto writeIO(uint24 address, uint8 data) -> void;
@@ -46,6 +102,15 @@ private:
     boolean audioBusy;
     boolean dataBusy;
   } io;
+
+  auto worker() -> void;
+  auto notify() -> void;
+
+  nall::thread thread;
+  std::mutex lock;
+  std::condition_variable wake;  //signaled on a new request, when the ring has room, or when unloading
+  bool running = false;
+  bool signaled = false;
 };
 
 extern MSU1 msu1;
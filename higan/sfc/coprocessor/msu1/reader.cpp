@@ -0,0 +1,164 @@
+//files are opened on the emulation thread, as platform->open() takes a shared node reference.
+//the opened file is then handed to the worker by move, and is only ever seeked and read by the worker.
+//audio tracks have their "MSU1" header validated, and wrap back to their loop offset at the end of the file,
+//so that repeating tracks continue seamlessly from the ring.
+
+auto MSU1::Reader::open(Shared::File file, uint32 offset, bool audio) -> void {
+  lock.lock();
+  pending = move(file);
+  replace = true;
+  this->audio = audio;
+  this->offset = offset;
+  requested++;
+  lock.unlock();
+  msu1.notify();
+}
+
+auto MSU1::Reader::seek(uint32 offset) -> void {
+  lock.lock();
+  this->offset = offset;
+  requested++;
+  lock.unlock();
+  msu1.notify();
+}
+
+auto MSU1::Reader::close() -> void {
+  pending.reset();
+  file.reset();
+  replace = false;
+  requested = 0;
+  served = 0;
+  streaming = false;
+  result = {};
+  completed = 0;
+  head = 0;
+  tail = 0;
+}
+
+auto MSU1::Reader::wait() -> void {
+  if(ready()) return;
+  std::unique_lock<std::mutex> guard(lock);
+  filled.wait(guard, [&] { return ready(); });
+}
+
+//the worker stays well ahead of the read position: this only waits when the host storage cannot keep up.
+auto MSU1::Reader::read() -> uint8 {
+  wait();
+  if(!result.valid) return 0x00;
+  auto index = tail.load(std::memory_order_relaxed);
+  if(head.load(std::memory_order_acquire) == index) {
+    std::unique_lock<std::mutex> guard(lock);
+    filled.wait(guard, [&] {
+      return head.load(std::memory_order_acquire) != index || !streaming.load(std::memory_order_acquire);
+    });
+    if(head.load(std::memory_order_acquire) == index) return 0x00;
+  }
+  uint8 data = ring[index & Capacity - 1];
+  tail.store(++index, std::memory_order_release);
+  //the worker fills whole chunks: it is only woken once a chunk has been consumed
+  if(index % Chunk == 0) msu1.notify();
+  return data;
+}
+
+//returns true if any work was performed
+auto MSU1::Reader::service() -> bool {
+  lock.lock();
+  if(served == requested) {
+    lock.unlock();
+    if(!streaming) return false;
+    uint free = Capacity - (head.load(std::memory_order_relaxed) - tail.load(std::memory_order_acquire));
+    if(free < Chunk) return false;
+    fill(Chunk);
+    publish();
+    return true;
+  }
+
+  served = requested;
+  bool replaced = replace;
+  if(replace) file = move(pending), replace = false;
+  uint32 offset = this->offset;
+  looping = audio;
+  lock.unlock();
+
+  if(replaced) {
+    result = {};
+    if(file && !looping) {
+      result.valid = true;
+      result.size = file->size();
+    }
+    if(file && looping && file->size() >= 8) {
+      file->seek(0);
+      if(file->readm(4) == 0x4d535531) {  //"MSU1"
+        result.valid = true;
+        result.size = file->size() & ~3;  //a trailing partial sample is ignored
+        result.loopOffset = 8 + file->readl(4) * 4;
+        if(result.loopOffset > result.size) result.loopOffset = 8;
+      }
+    }
+  }
+
+  //the emulation thread does not access the ring until this request is marked as completed
+  head.store(0, std::memory_order_relaxed);
+  tail.store(0, std::memory_order_relaxed);
+  position = offset;
+  streaming = result.valid && position < result.size;
+  if(streaming) {
+    file->seek(position);
+    fill(Preload);
+  }
+  completed.store(served, std::memory_order_release);
+  publish();
+  return true;
+}
+
+auto MSU1::Reader::fill(uint bytes) -> void {
+  auto index = head.load(std::memory_order_relaxed);
+  while(bytes--) {
+    if(position >= result.size) {
+      if(!looping || result.loopOffset >= result.size) {
+        //the final bytes are published before the end of the stream, so that neither can be observed without the other
+        head.store(index, std::memory_order_release);
+        streaming.store(false, std::memory_order_release);
+        return;
+      }
+      file->seek(position = result.loopOffset);
+    }
+    ring[index++ & Capacity - 1] = file->read();
+    position++;
+  }
+  head.store(index, std::memory_order_release);
+}
+
+//wakes the emulation thread if it is waiting on this reader.
+//the lock is taken so that the wakeup cannot arrive between its check of the ring and its wait.
+auto MSU1::Reader::publish() -> void {
+  lock.lock();
+  lock.unlock();
+  filled.notify_one();
+}
+
+//the worker sleeps until a reader has work for it: requests are served as soon as they are made,
+//and the rings are refilled each time the emulation thread has consumed a chunk from them.
+auto MSU1::worker() -> void {
+  while(true) {
+    {
+      std::unique_lock<std::mutex> guard(lock);
+      wake.wait(guard, [&] { return signaled || !running; });
+      if(!running) return;
+      signaled = false;
+    }
+    bool active = true;
+    while(active) {
+      active = false;
+      active |= dataReader.service();
+      active |= audioReader.service();
+    }
+  }
+}
+
+auto MSU1::notify() -> void {
+  lock.lock();
+  signaled = true;
+  lock.unlock();
+  wake.notify_one();
+}
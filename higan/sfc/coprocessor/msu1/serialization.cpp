@@ -1,5 +1,5 @@
 auto MSU1::serialize(serializer& s) -> void {
-  Thread::serialize(s);
+  Timer::serialize(s);
 
   s.integer(io.dataSeekOffset);
   s.integer(io.dataReadOffset);
@@ -19,6 +19,11 @@ auto MSU1::serialize(serializer& s) -> void {
   s.boolean(io.audioBusy);
   s.boolean(io.dataBusy);
 
-  dataOpen();
-  audioOpen();
+  if(s.mode() == serializer::Load) {
+    dataOpen();
+    audioOpen();
+    dataReader.wait();
+    audioReader.wait();
+    update();
+  }
 }
@@ -13,7 +13,7 @@ auto NECDSP::unload() -> void {
   debugger = {};
   node = {};
 
-  cpu.coprocessors.removeByValue(this);
+  cpu.deferred.removeByValue(this);
   Thread::destroy();
 }
 
@@ -28,5 +28,5 @@ auto NECDSP::main() -> void {
 auto NECDSP::power() -> void {
   uPD96050::power();
   Thread::create(Frequency, {&NECDSP::main, this});
-  cpu.coprocessors.append(this);
+  cpu.deferred.append(this);
 }
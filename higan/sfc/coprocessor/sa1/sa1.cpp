@@ -22,7 +22,7 @@ auto SA1::unload() -> void {
   iram.reset();
   bwram.reset();
 
-  cpu.coprocessors.removeByValue(this);
+  cpu.deferred.removeByValue(this);
   Thread::destroy();
 }
 
@@ -133,7 +133,7 @@ auto SA1::power() -> void {
   WDC65816::power();
 
   Thread::create(system.cpuFrequency(), {&SA1::main, this});
-  cpu.coprocessors.append(this);
+  cpu.deferred.append(this);
 
   bwram.dma = false;
   for(uint address : range(iram.size())) {
@@ -0,0 +1,69 @@
+auto SDD1::Cache::reset() -> void {
+  for(auto& entry : entries) entry = {};
+  tick = 0;
+  active = nullptr;
+  origin = 0;
+  index = 0;
+  live = false;
+}
+
+auto SDD1::Cache::begin(uint24 origin) -> void {
+  this->origin = origin;
+  index = 0;
+
+  auto key = this->key(origin);
+  auto victim = &entries[0];
+  for(auto& entry : entries) {
+    if(entry.used && entry.key == key) {
+      entry.used = ++tick;
+      active = &entry;
+      live = false;
+      return;
+    }
+    if(entry.used < victim->used) victim = &entry;
+  }
+
+  //replace the least recently used entry
+  victim->key = key;
+  victim->used = ++tick;
+  victim->data.resize(0);
+  active = victim;
+  sdd1.decompressor.init(origin);
+  live = true;
+}
+
+auto SDD1::Cache::read() -> uint8 {
+  if(!live) {
+    if(index < active->data.size()) return active->data[index++];
+    synchronize();
+  }
+
+  uint8 data = sdd1.decompressor.read();
+  if(active && index == active->data.size() && index < Capacity) active->data.append(data);
+  index++;
+  return data;
+}
+
+//replays the decompressor up to the current stream position
+auto SDD1::Cache::synchronize() -> void {
+  if(live) return;
+  sdd1.decompressor.init(origin);
+  for(uint n : range(index)) sdd1.decompressor.read();
+  live = true;
+}
+
+//continues the current stream without the cache: used when the MMC banks change mid-transfer,
+//as the remainder of the stream no longer matches the key of its entry.
+auto SDD1::Cache::detach() -> void {
+  synchronize();
+  active = nullptr;
+}
+
+auto SDD1::Cache::key(uint24 origin) const -> uint64 {
+  uint64 key = origin;
+  key |= (uint64)(sdd1.r4804 & 15) << 24;
+  key |= (uint64)(sdd1.r4805 & 15) << 28;
+  key |= (uint64)(sdd1.r4806 & 15) << 32;
+  key |= (uint64)(sdd1.r4807 & 15) << 36;
+  return key;
+}
@@ -0,0 +1,32 @@
+//decompressed stream cache
+//games decompress the same graphics repeatedly (eg on every room transition.)
+//streams are keyed by their origin and the MMC bank mapping, and repeated transfers are served by copying;
+//the decompressor only runs when a stream is first seen, or when it is read past its cached length.
+
+struct Cache {
+  enum : uint { Entries = 32 };
+  enum : uint { Capacity = 65536 };  //the longest possible DMA transfer
+
+  auto reset() -> void;
+  auto begin(uint24 origin) -> void;
+  auto read() -> uint8;
+  auto synchronize() -> void;
+  auto detach() -> void;
+  auto serialize(serializer&) -> void;
+
+private:
+  struct Entry {
+    uint64 key = 0;
+    uint64 used = 0;  //0 = empty
+    vector<uint8> data;
+  };
+
+  auto key(uint24 origin) const -> uint64;
+
+  Entry entries[Entries];
+  uint64 tick = 0;
+  Entry* active = nullptr;  //entry that the current stream is served from or appended to
+  uint24 origin;
+  uint index = 0;           //bytes read from the current stream
+  bool live = false;        //true when the decompressor is in sync with index
+};
@@ -1,9 +1,11 @@
 SDD1 sdd1;
 #include "decompressor.cpp"
+#include "cache.cpp"
 #include "serialization.cpp"
 
 auto SDD1::unload() -> void {
   rom.reset();
+  cache.reset();
 }
 
 auto SDD1::power() -> void {
@@ -24,6 +26,7 @@ auto SDD1::power() -> void {
   }
 
   dmaReady = false;
+  cache.reset();
 }
 
 auto SDD1::ioRead(uint24 address, uint8 data) -> uint8 {
@@ -44,6 +47,7 @@ auto SDD1::ioRead(uint24 address, uint8 data) -> uint8 {
 
 auto SDD1::ioWrite(uint24 address, uint8 data) -> void {
   address = 0x4800 | address.bit(0,3);
+  if(dmaReady && address >= 0x4804 && address <= 0x4807) cache.detach();
 
   switch(address) {
   case 0x4800: r4800 = data; break;
@@ -101,12 +105,12 @@ auto SDD1::mcuRead(uint24 address, uint8 data) -> uint8 {
         if(address == dma[n].address) {
           if(!dmaReady) {
             //prepare streaming decompression
-            decompressor.init(address);
+            cache.begin(address);
             dmaReady = true;
           }
 
           //fetch a decompressed byte; once finished, disable channel and invalidate buffer
-          data = decompressor.read();
+          data = cache.read();
           if(--dma[n].size == 0) {
             dmaReady = false;
             r4801.bit(n) = 0;
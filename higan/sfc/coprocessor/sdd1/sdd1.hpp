@@ -35,6 +35,9 @@ private:
 public:
   #include "decompressor.hpp"
   Decompressor decompressor;
+
+  #include "cache.hpp"
+  Cache cache;
 };
 
 extern SDD1 sdd1;
@@ -10,9 +10,17 @@ auto SDD1::serialize(serializer& s) -> void {
     s.integer(channel.size);
   }
   s.integer(dmaReady);
+  cache.serialize(s);
   decompressor.serialize(s);
 }
 
+//only the decompressor is serialized: an active stream is brought up to date before saving,
+//and continues without the cache after loading.
+auto SDD1::Cache::serialize(serializer& s) -> void {
+  if(s.mode() == serializer::Save && sdd1.dmaReady) synchronize();
+  if(s.mode() == serializer::Load) active = nullptr, live = true;
+}
+
 auto SDD1::Decompressor::serialize(serializer& s) -> void {
   im.serialize(s);
   gcd.serialize(s);
@@ -1,5 +1,5 @@
 auto SharpRTC::serialize(serializer& s) -> void {
-  Thread::serialize(s);
+  Timer::serialize(s);
 
   s.integer((uint&)state);
   s.integer(index);
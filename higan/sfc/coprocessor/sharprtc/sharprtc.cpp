@@ -9,9 +9,6 @@ auto SharpRTC::load(Node::Object parent) -> void {
 
 auto SharpRTC::main() -> void {
   tickSecond();
-
-  Thread::step(1);
-  Thread::synchronize(cpu);
 }
 
 auto SharpRTC::initialize() -> void {
@@ -25,13 +22,11 @@ auto SharpRTC::initialize() -> void {
 }
 
 auto SharpRTC::unload() -> void {
-  cpu.coprocessors.removeByValue(this);
-  Thread::destroy();
+  Timer::destroy();
 }
 
 auto SharpRTC::power() -> void {
-  Thread::create(1, {&SharpRTC::main, this});
-  cpu.coprocessors.append(this);
+  Timer::create(1, {&SharpRTC::main, this});
 
   state = State::Read;
   index = -1;
@@ -51,6 +46,7 @@ auto SharpRTC::synchronize(uint64 timestamp) -> void {
 }
 
 auto SharpRTC::read(uint24 address, uint8 data) -> uint8 {
+  cpu.synchronize(*this);
   address &= 1;
 
   if(address == 0) {
@@ -71,6 +67,7 @@ auto SharpRTC::read(uint24 address, uint8 data) -> uint8 {
 }
 
 auto SharpRTC::write(uint24 address, uint8 data) -> void {
+  cpu.synchronize(*this);
   address &= 1, data &= 15;
 
   if(address == 1) {
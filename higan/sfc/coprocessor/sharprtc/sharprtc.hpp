@@ -1,9 +1,7 @@
-struct SharpRTC : Thread {
+struct SharpRTC : Timer {
   Node::RealTimeClock rtc;
   auto load(Node::Object) -> void;
 
-  using Thread::synchronize;
-
   auto main() -> void;
 
   auto initialize() -> void;
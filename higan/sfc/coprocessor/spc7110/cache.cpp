@@ -0,0 +1,105 @@
+//decompressed stream cache
+//games decompress the same data repeatedly (eg font glyphs and menu graphics.)
+//streams are keyed by mode, origin and data ROM size, and each decoded word is recorded;
+//repeated transfers are served from the cache, and the decompressor only runs when a stream
+//is first seen, or when it is decoded past its cached length.
+
+struct DecompressorCache {
+  enum : uint { Entries = 32 };
+  enum : uint { Capacity = 65536 };  //decoded words per entry
+
+  DecompressorCache(Decompressor& decompressor) : decompressor(decompressor) {}
+
+  auto reset() -> void {
+    for(auto& entry : entries) entry = {};
+    tick = 0;
+    active = nullptr;
+    mode = 0;
+    origin = 0;
+    index = 0;
+    live = true;
+  }
+
+  auto initialize(uint mode, uint origin, uint size) -> void {
+    this->mode = mode;
+    this->origin = origin;
+    index = 0;
+
+    uint64 key = origin | mode << 23 | (uint64)size << 25;
+    auto victim = &entries[0];
+    for(auto& entry : entries) {
+      if(entry.used && entry.key == key) {
+        entry.used = ++tick;
+        active = &entry;
+        decompressor.bpp = 1 << mode;
+        live = false;
+        return;
+      }
+      if(entry.used < victim->used) victim = &entry;
+    }
+
+    //replace the least recently used entry
+    victim->key = key;
+    victim->used = ++tick;
+    victim->data.resize(0);
+    active = victim;
+    decompressor.initialize(mode, origin);
+    live = true;
+  }
+
+  auto decode() -> void {
+    if(!live) {
+      if(index < active->data.size()) { decompressor.result = active->data[index++]; return; }
+      synchronize();
+    }
+
+    decompressor.decode();
+    if(active && index == active->data.size() && index < Capacity) active->data.append(decompressor.result);
+    index++;
+  }
+
+  //replays the decompressor up to the current stream position
+  auto synchronize() -> void {
+    if(live) return;
+    decompressor.initialize(mode, origin);
+    for(uint n : range(index)) decompressor.decode();
+    live = true;
+  }
+
+  //continues the current stream without the cache: used when the data ROM size changes mid-stream,
+  //as the remainder of the stream no longer matches the key of its entry.
+  auto detach() -> void {
+    synchronize();
+    active = nullptr;
+  }
+
+  //a stream served from the cache is saved by position, rather than by replaying the decompressor on every save;
+  //it is replayed once after loading, replacing the stale decompressor state that was saved alongside it.
+  //this must be serialized after both the decompressor and the data ROM mapping registers.
+  auto serialize(serializer& s) -> void {
+    s.integer(live);
+    s.integer(mode);
+    s.integer(origin);
+    s.integer(index);
+    if(s.mode() == serializer::Load) {
+      active = nullptr;
+      synchronize();
+    }
+  }
+
+private:
+  struct Entry {
+    uint64 key = 0;
+    uint64 used = 0;  //0 = empty
+    vector<uint32> data;
+  };
+
+  Decompressor& decompressor;
+  Entry entries[Entries];
+  uint64 tick = 0;
+  Entry* active = nullptr;  //entry that the current stream is served from or appended to
+  uint mode = 0;
+  uint origin = 0;
+  uint index = 0;           //words decoded from the current stream
+  bool live = true;         //true when the decompressor is in sync with index
+};
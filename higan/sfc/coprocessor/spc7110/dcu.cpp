@@ -1,4 +1,5 @@
 #include "decompressor.cpp"
+#include "cache.cpp"
 
 auto SPC7110::dcuLoadAddress() -> void {
   uint table = r4801 | r4802 << 8 | r4803 << 16;
@@ -15,11 +16,11 @@ auto SPC7110::dcuBeginTransfer() -> void {
   if(dcuMode == 3) return;  //invalid mode
 
   addClocks(20);
-  decompressor->initialize(dcuMode, dcuAddress);
-  decompressor->decode();
+  cache->initialize(dcuMode, dcuAddress, r4834 & 3);
+  cache->decode();
 
   uint seek = r480b & 2 ? r4805 | r4806 << 8 : 0;
-  while(seek--) decompressor->decode();
+  while(seek--) cache->decode();
 
   r480c |= 0x80;
   dcuOffset = 0;
@@ -47,7 +48,7 @@ auto SPC7110::dcuRead() -> uint8 {
       }
 
       uint seek = r480b & 1 ? r4807 : (uint8)1;
-      while(seek--) decompressor->decode();
+      while(seek--) cache->decode();
     }
   }
 
@@ -57,4 +57,5 @@ auto SPC7110::serialize(serializer& s) -> void {
   s.integer(r4832);
   s.integer(r4833);
   s.integer(r4834);
+  cache->serialize(s);
 }
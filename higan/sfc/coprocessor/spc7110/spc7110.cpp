@@ -6,9 +6,11 @@ SPC7110 spc7110;
 
 SPC7110::SPC7110() {
   decompressor = new Decompressor(*this);
+  cache = new DecompressorCache(*decompressor);
 }
 
 SPC7110::~SPC7110() {
+  delete cache;
   delete decompressor;
 }
 
@@ -28,14 +30,15 @@ auto SPC7110::unload() -> void {
   prom.reset();
   drom.reset();
   ram.reset();
+  cache->reset();
 
-  cpu.coprocessors.removeByValue(this);
+  cpu.deferred.removeByValue(this);
   Thread::destroy();
 }
 
 auto SPC7110::power() -> void {
   Thread::create(21'477'272, {&SPC7110::main, this});
-  cpu.coprocessors.append(this);
+  cpu.deferred.append(this);
 
   r4801 = 0x00;
   r4802 = 0x00;
@@ -52,6 +55,7 @@ auto SPC7110::power() -> void {
   dcuPending = 0;
   dcuMode = 0;
   dcuAddress = 0;
+  cache->reset();
 
   r4810 = 0x00;
   r4811 = 0x00;
@@ -229,7 +233,7 @@ auto SPC7110::write(uint24 addr, uint8 data) -> void {
   case 0x4831: r4831 = data & 0x07; break;
   case 0x4832: r4832 = data & 0x07; break;
   case 0x4833: r4833 = data & 0x07; break;
-  case 0x4834: r4834 = data & 0x07; break;
+  case 0x4834: cache->detach(); r4834 = data & 0x07; break;
   }
 }
 
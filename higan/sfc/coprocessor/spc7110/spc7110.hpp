@@ -1,4 +1,5 @@
 struct Decompressor;
+struct DecompressorCache;
 
 struct SPC7110 : Thread {
   SPC7110();
@@ -75,6 +76,7 @@ private:
   uint dcuOffset;
   uint8 dcuTile[32];
   Decompressor* decompressor;
+  DecompressorCache* cache;
 
   //data port unit
   uint8 r4810;  //data port read + seek
@@ -9,6 +9,8 @@ auto SuperFX::CPUROM::size() const -> uint {
 }
 
 auto SuperFX::CPUROM::read(uint24 address, uint8 data) -> uint8 {
+  //the GSU may have stopped since it was last synchronized
+  if(superfx.regs.sfr.g) cpu.synchronize(superfx);
   if(superfx.regs.sfr.g && superfx.regs.scmr.ron) {
     static const uint8 vector[16] = {
       0x00, 0x01, 0x00, 0x01, 0x04, 0x01, 0x00, 0x01,
@@ -34,11 +36,13 @@ auto SuperFX::CPURAM::size() const -> uint {
 }
 
 auto SuperFX::CPURAM::read(uint24 address, uint8 data) -> uint8 {
+  if(superfx.regs.sfr.g) cpu.synchronize(superfx);
   if(superfx.regs.sfr.g && superfx.regs.scmr.ran) return data;
   return superfx.ram.read(address, data);
 }
 
 auto SuperFX::CPURAM::write(uint24 address, uint8 data) -> void {
+  if(superfx.regs.sfr.g) cpu.synchronize(superfx);
   superfx.ram.write(address, data);
 }
 
@@ -21,7 +21,7 @@ auto SuperFX::unload() -> void {
   ram.reset();
   bram.reset();
 
-  cpu.coprocessors.removeByValue(this);
+  cpu.deferred.removeByValue(this);
   Thread::destroy();
 }
 
@@ -48,7 +48,7 @@ auto SuperFX::power() -> void {
   GSU::power();
 
   Thread::create(Frequency, {&SuperFX::main, this});
-  cpu.coprocessors.append(this);
+  cpu.deferred.append(this);
 
   romMask = rom.size() - 1;
   ramMask = ram.size() - 1;
@@ -17,11 +17,15 @@ auto CPU::load(Node::Object parent) -> void {
   version = parent->append<Node::Natural>("Version", 2);
   version->setAllowedValues({1, 2});
 
+  //a conservative fallback for software that relies on cycle-exact communication with a coprocessor
+  lockstepCoprocessors = parent->append<Node::Boolean>("Lockstep Coprocessors", false);
+
   debugger.load(node);
 }
 
 auto CPU::unload() -> void {
   version = {};
+  lockstepCoprocessors = {};
   debugger = {};
   node = {};
 }
@@ -66,8 +70,8 @@ auto CPU::map() -> void {
 
   reader = {&CPU::readRAM, this};
   writer = {&CPU::writeRAM, this};
-  bus.map(reader, writer, "00-3f,80-bf:0000-1fff", 0x2000);
-  bus.map(reader, writer, "7e-7f:0000-ffff", 0x20000);
+  bus.direct(bus.map(reader, writer, "00-3f,80-bf:0000-1fff", 0x2000), wram);
+  bus.direct(bus.map(reader, writer, "7e-7f:0000-ffff", 0x20000), wram);
 
   reader = {&CPU::readAPU, this};
   writer = {&CPU::writeAPU, this};
@@ -86,6 +90,7 @@ auto CPU::power(bool reset) -> void {
   WDC65816::power();
   create(system.cpuFrequency(), {&CPU::main, this});
   coprocessors.reset();
+  deferred.reset();
   PPUcounter::reset();
   PPUcounter::scanline = {&CPU::scanline, this};
 
@@ -109,6 +114,7 @@ auto CPU::power(bool reset) -> void {
   status.hdmaPosition = 1104;
   status.resetPending = 1;
   status.interruptPending = 1;
+  status.horizon = lockstepCoprocessors->value() ? 0 : Horizon * scalar();
 }
 
 }
@@ -1,6 +1,7 @@
 struct CPU : WDC65816, Thread, PPUcounter {
   Node::Component node;
   Node::Natural version;
+  Node::Boolean lockstepCoprocessors;
 
   struct Debugger {
     //debugger.cpp
@@ -84,9 +85,16 @@ struct CPU : WDC65816, Thread, PPUcounter {
   auto serialize(serializer&) -> void;
 
   uint8 wram[128 * 1024];
-  vector<Thread*> coprocessors;
   vector<Thread*> peripherals;
 
+  //coprocessors are synchronized to the S-CPU after every bus cycle.
+  //deferred coprocessors instead synchronize themselves whenever the S-CPU accesses their MMIO or memory,
+  //and may otherwise fall behind the S-CPU by up to Horizon clocks (which bounds the latency of their IRQs.)
+  //all coprocessors are synchronized at the start of every scanline.
+  enum : uint { Horizon = 256 };
+  vector<Thread*> coprocessors;
+  vector<Thread*> deferred;
+
 private:
   struct Counter {
     uint cpu = 0;
@@ -128,6 +136,8 @@ private:
     bool hdmaMode = 0;  //0 = init, 1 = run
 
     uint autoJoypadCounter = 33;  //state machine; 4224 / 128 = 33 (inactive)
+
+    uintmax horizon = 0;  //Horizon in thread clock units; 0 when lockstepping coprocessors
   } status;
 
   struct IO {
@@ -189,9 +199,11 @@ private:
     auto readB(uint8 address, bool valid) -> uint8;
     auto writeA(uint24 address, uint8 data) -> void;
     auto writeB(uint8 address, uint8 data, bool valid) -> void;
+    auto portB(uint2 index) const -> uint8;
     auto transfer(uint24 address, uint2 index) -> void;
 
     auto dmaRun() -> void;
+    auto dmaBurst(uint2& index) -> bool;
     auto hdmaActive() -> bool;
     auto hdmaFinished() -> bool;
     auto hdmaReset() -> void;
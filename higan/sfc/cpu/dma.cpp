@@ -82,13 +82,18 @@ inline auto CPU::Channel::writeB(uint8 address, uint8 data, bool valid) -> void
   if(valid) bus.write(0x2100 | address, data);
 }
 
-inline auto CPU::Channel::transfer(uint24 addressA, uint2 index) -> void {
+inline auto CPU::Channel::portB(uint2 index) const -> uint8 {
   uint8 addressB = targetAddress;
   switch(transferMode) {
   case 1: case 5: addressB += index.bit(0); break;
   case 3: case 7: addressB += index.bit(1); break;
   case 4: addressB += index; break;
   }
+  return addressB;
+}
+
+inline auto CPU::Channel::transfer(uint24 addressA, uint2 index) -> void {
+  uint8 addressB = portB(index);
 
   //transfers from WRAM to WRAM are invalid
   bool valid = addressB != 0x80 || ((addressA & 0xfe0000) != 0x7e0000 && (addressA & 0x40e000) != 0x0000);
@@ -109,8 +114,16 @@ inline auto CPU::Channel::dmaRun() -> void {
   step(8);
   edge();
 
+  //bulk transfers are only possible from the A-bus to the PPU OAM, VRAM and CGRAM data ports
+  bool bulk = direction == 0;
+  for(uint index : range(4)) {
+    auto port = portB(index);
+    if(port != 0x04 && port != 0x18 && port != 0x19 && port != 0x22) bulk = false;
+  }
+
   uint2 index = 0;
   do {
+    if(bulk && dmaBurst(index)) break;
     transfer(sourceBank << 16 | sourceAddress, index++);
     if(!fixedTransfer) !reverseTransfer ? sourceAddress++ : sourceAddress--;
     edge();
@@ -119,6 +132,43 @@ inline auto CPU::Channel::dmaRun() -> void {
   dmaEnable = false;
 }
 
+//transfers as many bytes as possible in one block, and then advances the clock once by their total.
+//the block must be read from plain memory, and must end before the next scanline, DRAM refresh and HDMA trigger.
+//interrupts are not serviced until the DMA completes; and while the PPU is blanked, it neither outputs
+//nor rejects the OAM, VRAM and CGRAM writes, so nothing else can observe when within the block each write lands.
+//returns true if the transfer has completed.
+inline auto CPU::Channel::dmaBurst(uint2& index) -> bool {
+  if(cpu.status.dmaPending || cpu.status.hdmaPending) return false;
+  if(cpu.peripherals || cpu.coprocessors || (cpu.deferred && !cpu.status.horizon)) return false;
+  if(!ppu.displayDisable() && cpu.vcounter() < ppu.vdisp()) return false;
+
+  uint limit = cpu.hperiod();
+  if(!cpu.status.dramRefresh) limit = min(limit, cpu.status.dramRefreshPosition);
+  if(!cpu.status.hdmaSetupTriggered) limit = min(limit, cpu.status.hdmaSetupPosition);
+  if(!cpu.status.hdmaTriggered) limit = min(limit, cpu.status.hdmaPosition);
+  if(cpu.hcounter() + 8 >= limit) return false;
+
+  uint remaining = transferSize ? (uint)transferSize : 65536;
+  uint length = min(remaining, (limit - 1 - cpu.hcounter()) / 8);
+  uint count = 0;
+  while(count < length) {
+    uint24 address = sourceBank << 16 | sourceAddress;
+    auto data = bus.direct(address);
+    if(!data) break;
+    cpu.r.mar = address;
+    cpu.r.mdr = *data;
+    bus.write(0x2100 | portB(index++), cpu.r.mdr);
+    if(!fixedTransfer) !reverseTransfer ? sourceAddress++ : sourceAddress--;
+    count++;
+  }
+  if(!count) return false;
+
+  step(count * 8);
+  edge();
+  transferSize -= count;
+  return count == remaining;
+}
+
 inline auto CPU::Channel::hdmaActive() -> bool {
   return hdmaEnable && !hdmaCompleted;
 }
@@ -48,6 +48,9 @@ auto CPU::step(uint clocks) -> void {
   Thread::step(clocks);
   for(auto peripheral : peripherals) Thread::synchronize(*peripheral);
   for(auto coprocessor : coprocessors) Thread::synchronize(*coprocessor);
+  for(auto coprocessor : deferred) {
+    if(coprocessor->clock() + status.horizon < clock()) Thread::synchronize(*coprocessor);
+  }
 }
 
 //called by ppu.tick() when Hcounter=0
@@ -55,6 +58,7 @@ auto CPU::scanline() -> void {
   //forcefully sync S-CPU to other processors, in case chips are not communicating
   Thread::synchronize(smp, ppu);
   for(auto coprocessor : coprocessors) Thread::synchronize(*coprocessor);
+  for(auto coprocessor : deferred) Thread::synchronize(*coprocessor);
 
   if(vcounter() == 0) {
     //HDMA setup triggers once every frame
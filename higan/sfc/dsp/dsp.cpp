@@ -21,16 +21,25 @@ auto DSP::load(Node::Object parent) -> void {
   stream->setChannels(2);
   stream->setFrequency(system.apuFrequency() / 768.0);
 
+  //runs each sample in one step, rather than synchronizing with the SMP on every DSP clock.
+  //the output is identical unless the SMP accesses the DSP in the middle of a sample: such accesses
+  //are instead seen at the end of the sample, up to 32 DSP clocks later than on real hardware.
+  fastMode = node->append<Node::Boolean>("Fast Mode", false);
+  fastMode->setDynamic(true);
+
   debugger.load(node);
 }
 
 auto DSP::unload() -> void {
   node = {};
   stream = {};
+  fastMode = {};
   debugger = {};
 }
 
 auto DSP::main() -> void {
+  fast = fastMode->latch();
+
   voice5(voice[0]);
   voice2(voice[1]);
   tick();
@@ -181,9 +190,15 @@ auto DSP::main() -> void {
   voice4(voice[0]);
   voice1(voice[2]);
   tick();
+
+  if(fast) {
+    Thread::step(3 * 8 * 32);
+    Thread::synchronize(smp);
+  }
 }
 
 auto DSP::tick() -> void {
+  if(fast) return;
   Thread::step(3 * 8);
   Thread::synchronize(smp);
 }
@@ -3,6 +3,7 @@
 struct DSP : Thread {
   Node::Component node;
   Node::Stream stream;
+  Node::Boolean fastMode;
 
   struct Debugger {
     //debugger.cpp
@@ -45,6 +46,8 @@ private:
      uint1 sample = 1;
   } clock;
 
+  bool fast = false;  //fastMode, as latched at the start of the current sample
+
   struct Master {
     uint1 reset = 1;
     uint1 mute = 1;
@@ -176,6 +179,7 @@ private:
 
   //echo.cpp
   auto calculateFIR(uint1 channel, int index) -> int;
+  auto calculateFIR(uint1 channel) -> int;
   auto echoOutput(uint1 channel) const -> int16;
   auto echoRead(uint1 channel) -> void;
   auto echoWrite(uint1 channel) -> void;
@@ -3,6 +3,17 @@ auto DSP::calculateFIR(uint1 channel, int index) -> int {
   return (sample * echo.fir[index]) >> 6;
 }
 
+//all eight taps at once: used in fast mode, where the partial sums are not observable between clocks.
+//the sum of the first seven taps wraps to 16 bits before the last tap is added, as on hardware.
+auto DSP::calculateFIR(uint1 channel) -> int {
+  int16 sample[8];
+  for(uint index : range(8)) sample[index] = echo.history[channel][(uint3)(echo._historyOffset + index + 1)];
+  int sum = 0;
+  for(uint index : range(7)) sum += sample[index] * echo.fir[index] >> 6;
+  sum = (int16)sum + (int16)(sample[7] * echo.fir[7] >> 6);
+  return sclamp<16>(sum) & ~1;
+}
+
 auto DSP::echoOutput(uint1 channel) const -> int16 {
   int16 masterOutput = master.output[channel] * master.volume[channel] >> 7;
     int16 echoOutput =    echo.input[channel] *   echo.volume[channel] >> 7;
@@ -33,6 +44,7 @@ auto DSP::echo22() -> void {
 
   echo._address = (echo._bank << 8) + echo._offset;
   echoRead(0);
+  if(fast) return;
 
   //FIR
   int l = calculateFIR(0, 0);
@@ -43,6 +55,8 @@ auto DSP::echo22() -> void {
 }
 
 auto DSP::echo23() -> void {
+  if(fast) return echoRead(1);
+
   int l = calculateFIR(0, 1) + calculateFIR(0, 2);
   int r = calculateFIR(1, 1) + calculateFIR(1, 2);
 
@@ -53,6 +67,8 @@ auto DSP::echo23() -> void {
 }
 
 auto DSP::echo24() -> void {
+  if(fast) return;
+
   int l = calculateFIR(0, 3) + calculateFIR(0, 4) + calculateFIR(0, 5);
   int r = calculateFIR(1, 3) + calculateFIR(1, 4) + calculateFIR(1, 5);
 
@@ -61,6 +77,12 @@ auto DSP::echo24() -> void {
 }
 
 auto DSP::echo25() -> void {
+  if(fast) {
+    echo.input[0] = calculateFIR(0);
+    echo.input[1] = calculateFIR(1);
+    return;
+  }
+
   int l = echo.input[0] + calculateFIR(0, 6);
   int r = echo.input[1] + calculateFIR(1, 6);
 
@@ -30,3 +30,9 @@ alwaysinline auto Bus::read(uint24 address, uint8 data) -> uint8 {
 alwaysinline auto Bus::write(uint24 address, uint8 data) -> void {
   return writer[lookup[address]](target[address], data);
 }
+
+//returns nullptr if the address is not mapped to plain memory
+alwaysinline auto Bus::direct(uint24 address) const -> const uint8* {
+  if(auto data = plain[lookup[address]]) return data + target[address];
+  return nullptr;
+}
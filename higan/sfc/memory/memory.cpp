@@ -13,6 +13,7 @@ auto Bus::reset() -> void {
   for(auto id : range(256)) {
     reader[id].reset();
     writer[id].reset();
+    plain[id] = nullptr;
     counter[id] = 0;
   }
 
@@ -41,6 +42,7 @@ auto Bus::map(
 
   reader[id] = read;
   writer[id] = write;
+  plain[id] = nullptr;
 
   auto p = addr.split(":", 1L);
   auto banks = p(0).split(",");
@@ -60,6 +62,7 @@ auto Bus::map(
           if(pid && --counter[pid] == 0) {
             reader[pid].reset();
             writer[pid].reset();
+            plain[pid] = nullptr;
           }
 
           uint offset = reduce(bank << 16 | addr, mask);
@@ -76,6 +79,10 @@ auto Bus::map(
   return id;
 }
 
+auto Bus::direct(uint id, uint8* memory) -> void {
+  if(id) plain[id] = memory;
+}
+
 auto Bus::unmap(const string& addr) -> void {
   auto p = addr.split(":", 1L);
   auto banks = p(0).split(",");
@@ -95,6 +102,7 @@ auto Bus::unmap(const string& addr) -> void {
           if(pid && --counter[pid] == 0) {
             reader[pid].reset();
             writer[pid].reset();
+            plain[pid] = nullptr;
           }
 
           lookup[bank << 16 | addr] = 0;
@@ -38,12 +38,17 @@ struct Bus {
   ) -> uint;
   auto unmap(const string& address) -> void;
 
+  //mappings of plain memory (reads have no side effects, and return memory[target]) may be accessed directly
+  auto direct(uint id, uint8* memory) -> void;
+  auto direct(uint24 address) const -> const uint8*;
+
 private:
   uint8* lookup = nullptr;
   uint32* target = nullptr;
 
   function<uint8 (uint24, uint8)> reader[256];
   function<void  (uint24, uint8)> writer[256];
+  uint8* plain[256];
   uint24 counter[256];
 };
 
@@ -1,17 +1,22 @@
 struct ReadableMemory : AbstractMemory {
   auto reset() -> void override {
-    delete[] self.data;
-    self.data = nullptr;
+    release();
     self.size = 0;
   }
 
   auto allocate(uint size, uint8 fill = 0xff) -> void override {
-    delete[] self.data;
+    release();
     self.data = new uint8[self.size = size];
     for(uint address : range(size)) self.data[address] = fill;
   }
 
   auto load(shared_pointer<vfs::file> fp) -> void {
+    if(auto data = Memory::Mapping::map(fp, self.size, self.size, 1)) {
+      release();
+      self.data = (uint8*)data;
+      self.mapped = true;
+      return;
+    }
     fp->read(self.data, min(fp->size(), self.size));
   }
 
@@ -39,8 +44,16 @@ struct ReadableMemory : AbstractMemory {
   }
 
 private:
+  auto release() -> void {
+    if(self.mapped) Memory::Mapping::unmap(self.data, self.size, 1);
+    else delete[] self.data;
+    self.data = nullptr;
+    self.mapped = false;
+  }
+
   struct {
     uint8* data = nullptr;
     uint size = 0;
+    bool mapped = false;
   } self;
 };
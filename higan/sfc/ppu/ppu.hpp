@@ -34,6 +34,7 @@ struct PPU : Thread, PPUcounter {
   auto interlace() const -> bool { return self.interlace; }
   auto overscan() const -> bool { return self.overscan; }
   auto vdisp() const -> uint { return self.vdisp; }
+  auto displayDisable() const -> bool { return io.displayDisable; }
 
   //ppu.cpp
   auto load(Node::Object) -> void;
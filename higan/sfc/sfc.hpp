@@ -2,6 +2,7 @@
 //started: 2004-10-14
 
 #include <higan/higan.hpp>
+#include <condition_variable>
 
 #include <component/processor/arm7tdmi/arm7tdmi.hpp>
 #include <component/processor/gsu/gsu.hpp>
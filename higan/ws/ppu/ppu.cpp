@@ -172,7 +172,9 @@ auto PPU::main() -> void {
     auto output = this->output + y * (224 + 13);
     latchRegisters();
     latchSprites(y);
-    for(uint x : range(224)) {
+    //rendering has no side effects beyond the output buffer, so it can be skipped when the frame will be discarded
+    if(screen->skip()) step(224);
+    else for(uint x : range(224)) {
       s.pixel = {Pixel::Source::Back, 0x000};
       if(r.lcdEnable) {
         renderBack();
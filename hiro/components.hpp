@@ -85,6 +85,12 @@
   #undef Hiro_TreeView
 #endif
 
+//platform-specific features
+
+#if defined(HIRO_GTK)
+  #define Hiro_TableViewVirtual  //TableView::setItemCount() requests rows on demand, rather than creating them all
+#endif
+
 //extensions
 
 #define Hiro_FixedLayout
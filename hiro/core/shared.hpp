@@ -703,6 +703,7 @@ struct TableView : sTableView {
   auto doActivate(sTableViewCell cell) const { return self().doActivate(cell); }
   auto doChange() const { return self().doChange(); }
   auto doContext() const { return self().doContext(); }
+  auto doData(sTableViewItem item) const { return self().doData(item); }
   auto doEdit(sTableViewCell cell) const { return self().doEdit(cell); }
   auto doSort(sTableViewColumn column) const { return self().doSort(column); }
   auto doToggle(sTableViewCell cell) const { return self().doToggle(cell); }
@@ -714,6 +715,7 @@ struct TableView : sTableView {
   auto onActivate(const function<void (TableViewCell)>& callback = {}) { return self().onActivate(callback), *this; }
   auto onChange(const function<void ()>& callback = {}) { return self().onChange(callback), *this; }
   auto onContext(const function<void ()>& callback = {}) { return self().onContext(callback), *this; }
+  auto onData(const function<void (TableViewItem)>& callback = {}) { return self().onData(callback), *this; }
   auto onEdit(const function<void (TableViewCell)>& callback = {}) { return self().onEdit(callback), *this; }
   auto onSort(const function<void (TableViewColumn)>& callback = {}) { return self().onSort(callback), *this; }
   auto onToggle(const function<void (TableViewCell)>& callback = {}) { return self().onToggle(callback), *this; }
@@ -730,9 +732,12 @@ struct TableView : sTableView {
   auto setBordered(bool bordered = true) { return self().setBordered(bordered), *this; }
   auto setForegroundColor(Color color = {}) { return self().setForegroundColor(color), *this; }
   auto setHeadered(bool headered = true) { return self().setHeadered(headered), *this; }
+  auto setItemCount(uint count) { return self().setItemCount(count), *this; }
   auto setSortable(bool sortable = true) { return self().setSortable(sortable), *this; }
   auto sort() { return self().sort(), *this; }
   auto sortable() const { return self().sortable(); }
+  auto updateItem(uint position) { return self().updateItem(position), *this; }
+  auto updateItems() { return self().updateItems(), *this; }
 };
 #endif
 
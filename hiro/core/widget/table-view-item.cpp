@@ -82,6 +82,14 @@ auto mTableViewItem::setBackgroundColor(Color color) -> type& {
 }
 
 auto mTableViewItem::setFocused() -> type& {
+  #if defined(Hiro_TableViewVirtual)
+  if(auto parent = parentTableView()) {
+    if(parent->state.virtualized) {
+      if(auto self = parent->self()) self->_setItemFocused(offset());
+      return *this;
+    }
+  }
+  #endif
   signal(setFocused);
   return *this;
 }
@@ -105,6 +113,14 @@ auto mTableViewItem::setSelected(bool selected) -> type& {
     if(!parent->state.batchable && selected) {
       for(auto& item : parent->state.items) item->state.selected = false;
     }
+    #if defined(Hiro_TableViewVirtual)
+    //virtualized rows are selected through the table view, which tracks the selection by position
+    if(parent->state.virtualized) {
+      state.selected = selected;
+      if(auto self = parent->self()) self->_setItemSelected(offset(), selected);
+      return *this;
+    }
+    #endif
   }
   state.selected = selected;
   signal(setSelected, selected);
@@ -25,7 +25,7 @@ auto mTableView::append(sTableViewColumn column) -> type& {
 
 auto mTableView::append(sTableViewItem item) -> type& {
   state.items.append(item);
-  item->setParent(this, itemCount() - 1);
+  item->setParent(this, state.items.size() - 1);
   signal(append, item);
   return *this;
 }
@@ -40,6 +40,10 @@ auto mTableView::batchable() const -> bool {
 
 auto mTableView::batched() const -> vector<TableViewItem> {
   vector<TableViewItem> items;
+  if(state.virtualized) {
+    for(auto position : state.selection) items.append(item(position));
+    return items;
+  }
   for(auto& item : state.items) {
     if(item->selected()) items.append(item);
   }
@@ -65,6 +69,11 @@ auto mTableView::columns() const -> vector<TableViewColumn> {
   return columns;
 }
 
+//the item passed to onData(): ListView overrides this to supply ListViewItems
+auto mTableView::createItem() const -> sTableViewItem {
+  return TableViewItem{};
+}
+
 auto mTableView::doActivate(sTableViewCell cell) const -> void {
   if(state.onActivate) return state.onActivate(cell);
 }
@@ -77,6 +86,10 @@ auto mTableView::doContext() const -> void {
   if(state.onContext) return state.onContext();
 }
 
+auto mTableView::doData(sTableViewItem item) const -> void {
+  if(state.onData) return state.onData(item);
+}
+
 auto mTableView::doEdit(sTableViewCell cell) const -> void {
   if(state.onEdit) return state.onEdit(cell);
 }
@@ -97,17 +110,33 @@ auto mTableView::headered() const -> bool {
   return state.headered;
 }
 
+//when virtualized, rows are not stored: each call returns a new item, filled in by onData().
+//such items refer to the table view without being constructed by it, so changes made to them are not displayed.
 auto mTableView::item(unsigned position) const -> TableViewItem {
+  if(state.virtualized) {
+    if(position >= state.itemCount) return {};
+    TableViewItem item{createItem()};
+    item->adjustOffset(position - item->offset());
+    item->state.selected = (bool)state.selection.find(position);
+    doData(item);
+    item->mObject::state.parent = (mObject*)this;
+    return item;
+  }
   if(position < itemCount()) return state.items[position];
   return {};
 }
 
 auto mTableView::itemCount() const -> unsigned {
+  if(state.virtualized) return state.itemCount;
   return state.items.size();
 }
 
 auto mTableView::items() const -> vector<TableViewItem> {
   vector<TableViewItem> items;
+  if(state.virtualized) {
+    for(uint position : range(state.itemCount)) items.append(item(position));
+    return items;
+  }
   for(auto& item : state.items) items.append(item);
   return items;
 }
@@ -127,6 +156,11 @@ auto mTableView::onContext(const function<void ()>& callback) -> type& {
   return *this;
 }
 
+auto mTableView::onData(const function<void (TableViewItem)>& callback) -> type& {
+  state.onData = callback;
+  return *this;
+}
+
 auto mTableView::onEdit(const function<void (TableViewCell)>& callback) -> type& {
   state.onEdit = callback;
   return *this;
@@ -153,9 +187,10 @@ auto mTableView::remove(sTableViewColumn column) -> type& {
 }
 
 auto mTableView::remove(sTableViewItem item) -> type& {
+  if(state.virtualized) return *this;
   signal(remove, item);
   state.items.remove(item->offset());
-  for(uint n : range(item->offset(), itemCount())) {
+  for(uint n : range(item->offset(), state.items.size())) {
     state.items[n]->adjustOffset(-1);
   }
   item->setParent();
@@ -163,6 +198,9 @@ auto mTableView::remove(sTableViewItem item) -> type& {
 }
 
 auto mTableView::reset() -> type& {
+  state.virtualized = false;
+  state.itemCount = 0;
+  state.selection.reset();
   while(state.items) remove(state.items.last());
   while(state.columns) remove(state.columns.last());
   return *this;
@@ -175,6 +213,14 @@ auto mTableView::resizeColumns() -> type& {
 
 auto mTableView::selectAll() -> type& {
   if(!state.batchable) return *this;
+  #if defined(Hiro_TableViewVirtual)
+  if(state.virtualized) {
+    state.selection.reset();
+    for(uint position : range(state.itemCount)) state.selection.append(position);
+    signal(selectAll);
+    return *this;
+  }
+  #endif
   for(auto& item : state.items) {
     item->setSelected(true);
   }
@@ -182,6 +228,13 @@ auto mTableView::selectAll() -> type& {
 }
 
 auto mTableView::selectNone() -> type& {
+  #if defined(Hiro_TableViewVirtual)
+  if(state.virtualized) {
+    state.selection.reset();
+    signal(selectNone);
+    return *this;
+  }
+  #endif
   for(auto& item : state.items) {
     item->setSelected(false);
   }
@@ -189,6 +242,10 @@ auto mTableView::selectNone() -> type& {
 }
 
 auto mTableView::selected() const -> TableViewItem {
+  if(state.virtualized) {
+    if(state.selection) return item(state.selection.first());
+    return {};
+  }
   for(auto& item : state.items) {
     if(item->selected()) return item;
   }
@@ -231,6 +288,33 @@ auto mTableView::setHeadered(bool headered) -> type& {
   return *this;
 }
 
+//presents count rows whose contents are requested from onData() only as they are needed (eg when drawn),
+//so that very large lists do not need an item object per row. calling this again grows or shrinks the list
+//while keeping the remaining rows; updateItem() and updateItems() redraw rows whose contents have changed.
+//platforms without native support create an item for every row instead, filling each one through onData().
+auto mTableView::setItemCount(uint count) -> type& {
+  #if defined(Hiro_TableViewVirtual)
+  if(!state.virtualized) {
+    while(state.items) remove(state.items.last());
+    state.virtualized = true;
+  }
+  state.itemCount = count;
+  for(uint n = 0; n < state.selection.size();) {
+    if(state.selection[n] >= count) state.selection.remove(n);
+    else n++;
+  }
+  signal(setItemCount, count);
+  #else
+  while(state.items.size() > count) remove(state.items.last());
+  while(state.items.size() < count) {
+    auto item = createItem();
+    append(item);
+    doData(item);
+  }
+  #endif
+  return *this;
+}
+
 auto mTableView::setParent(mObject* parent, signed offset) -> type& {
   for(auto& item : reverse(state.items)) item->destruct();
   for(auto& column : reverse(state.columns)) column->destruct();
@@ -247,6 +331,7 @@ auto mTableView::setSortable(bool sortable) -> type& {
 }
 
 auto mTableView::sort() -> type& {
+  if(state.virtualized) return *this;  //the data source is responsible for its own order
   Sort sorting = Sort::None;
   uint offset = 0;
   for(auto& column : state.columns) {
@@ -272,4 +357,26 @@ auto mTableView::sortable() const -> bool {
   return state.sortable;
 }
 
+auto mTableView::updateItem(uint position) -> type& {
+  #if defined(Hiro_TableViewVirtual)
+  if(state.virtualized) {
+    signal(updateItem, position);
+    return *this;
+  }
+  #endif
+  if(position < state.items.size()) doData(state.items[position]);
+  return *this;
+}
+
+auto mTableView::updateItems() -> type& {
+  #if defined(Hiro_TableViewVirtual)
+  if(state.virtualized) {
+    signal(updateItems);
+    return *this;
+  }
+  #endif
+  for(auto& item : state.items) doData(item);
+  return *this;
+}
+
 #endif
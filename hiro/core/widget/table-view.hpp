@@ -13,9 +13,11 @@ struct mTableView : mWidget {
   auto column(uint position) const -> TableViewColumn;
   auto columnCount() const -> uint;
   auto columns() const -> vector<TableViewColumn>;
+  virtual auto createItem() const -> sTableViewItem;
   auto doActivate(sTableViewCell cell) const -> void;
   auto doChange() const -> void;
   auto doContext() const -> void;
+  auto doData(sTableViewItem item) const -> void;
   auto doEdit(sTableViewCell cell) const -> void;
   auto doSort(sTableViewColumn column) const -> void;
   auto doToggle(sTableViewCell cell) const -> void;
@@ -27,6 +29,7 @@ struct mTableView : mWidget {
   auto onActivate(const function<void (TableViewCell)>& callback = {}) -> type&;
   auto onChange(const function<void ()>& callback = {}) -> type&;
   auto onContext(const function<void ()>& callback = {}) -> type&;
+  auto onData(const function<void (TableViewItem)>& callback = {}) -> type&;
   auto onEdit(const function<void (TableViewCell)>& callback = {}) -> type&;
   auto onSort(const function<void (TableViewColumn)>& callback = {}) -> type&;
   auto onToggle(const function<void (TableViewCell)>& callback = {}) -> type&;
@@ -43,10 +46,13 @@ struct mTableView : mWidget {
   auto setBordered(bool bordered = true) -> type&;
   auto setForegroundColor(Color color = {}) -> type&;
   auto setHeadered(bool headered = true) -> type&;
+  auto setItemCount(uint count) -> type&;
   auto setParent(mObject* parent = nullptr, int offset = -1) -> type& override;
   auto setSortable(bool sortable = true) -> type&;
   auto sort() -> type&;
   auto sortable() const -> bool;
+  auto updateItem(uint position) -> type&;
+  auto updateItems() -> type&;
 
 //private:
   struct State {
@@ -58,14 +64,18 @@ struct mTableView : mWidget {
     vector<sTableViewColumn> columns;
     Color foregroundColor;
     bool headered = false;
+    uint itemCount = 0;
     vector<sTableViewItem> items;
     function<void (TableViewCell)> onActivate;
     function<void ()> onChange;
     function<void ()> onContext;
+    function<void (TableViewItem)> onData;
     function<void (TableViewCell)> onEdit;
     function<void (TableViewColumn)> onSort;
     function<void (TableViewCell)> onToggle;
+    vector<uint> selection;  //selected rows when virtualized
     bool sortable = false;
+    bool virtualized = false;
   } state;
 
   auto destruct() -> void override;
@@ -4,6 +4,7 @@ mListView::mListView() {
   mTableView::onActivate([&](auto) { doActivate(); });
   mTableView::onChange([&] { doChange(); });
   mTableView::onContext([&] { doContext(); });
+  mTableView::onData([&](TableViewItem item) { doData(ListViewItem{item}); });
   mTableView::onToggle([&](TableViewCell cell) {
     if(auto item = cell->parentTableViewItem()) {
       if(auto shared = item->instance.acquire()) {
@@ -21,6 +22,10 @@ auto mListView::batched() const -> vector<ListViewItem> {
   return result;
 }
 
+auto mListView::createItem() const -> sTableViewItem {
+  return ListViewItem{};
+}
+
 auto mListView::doActivate() const -> void {
   if(state.onActivate) state.onActivate();
 }
@@ -33,6 +38,10 @@ auto mListView::doContext() const -> void {
   if(state.onContext) state.onContext();
 }
 
+auto mListView::doData(ListViewItem item) const -> void {
+  if(state.onData) state.onData(item);
+}
+
 auto mListView::doToggle(ListViewItem item) const -> void {
   if(state.onToggle) state.onToggle(item);
 }
@@ -63,6 +72,11 @@ auto mListView::onContext(const function<void ()>& callback) -> type& {
   return *this;
 }
 
+auto mListView::onData(const function<void (ListViewItem)>& callback) -> type& {
+  state.onData = callback;
+  return *this;
+}
+
 auto mListView::onToggle(const function<void (ListViewItem)>& callback) -> type& {
   state.onToggle = callback;
   return *this;
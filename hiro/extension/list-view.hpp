@@ -16,15 +16,18 @@ struct mListView : mTableView {
 
   mListView();
   auto batched() const -> vector<ListViewItem>;
+  auto createItem() const -> sTableViewItem override;
   auto doActivate() const -> void;
   auto doChange() const -> void;
   auto doContext() const -> void;
+  auto doData(ListViewItem) const -> void;
   auto doToggle(ListViewItem) const -> void;
   auto item(uint position) const -> ListViewItem;
   auto items() const -> vector<ListViewItem>;
   auto onActivate(const function<void ()>& callback) -> type&;
   auto onChange(const function<void ()>& callback) -> type&;
   auto onContext(const function<void ()>& callback) -> type&;
+  auto onData(const function<void (ListViewItem)>& callback) -> type&;
   auto onToggle(const function<void (ListViewItem)>& callback) -> type&;
   auto reset() -> type& override;
   auto resizeColumn() -> type&;
@@ -36,6 +39,7 @@ struct mListView : mTableView {
     function<void ()> onActivate;
     function<void ()> onChange;
     function<void ()> onContext;
+    function<void (ListViewItem)> onData;
     function<void (ListViewItem)> onToggle;
   } state;
 };
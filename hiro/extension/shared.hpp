@@ -211,6 +211,7 @@ struct ListView : sListView {
   auto doActivate() const { return self().doActivate(); }
   auto doChange() const { return self().doChange(); }
   auto doContext() const { return self().doContext(); }
+  auto doData(ListViewItem item) const { return self().doData(item); }
   auto doToggle(ListViewItem item) const { return self().doToggle(item); }
   auto foregroundColor() const { return self().foregroundColor(); }
   auto item(uint position) const { return self().item(position); }
@@ -219,6 +220,7 @@ struct ListView : sListView {
   auto onActivate(const function<void ()>& callback = {}) { return self().onActivate(callback), *this; }
   auto onChange(const function<void ()>& callback = {}) { return self().onChange(callback), *this; }
   auto onContext(const function<void ()>& callback = {}) { return self().onContext(callback), *this; }
+  auto onData(const function<void (ListViewItem)>& callback = {}) { return self().onData(callback), *this; }
   auto onToggle(const function<void (ListViewItem)>& callback = {}) { return self().onToggle(callback), *this; }
   auto remove(sListViewItem item) { return self().remove(item), *this; }
   auto reset() { return self().reset(), *this; }
@@ -229,5 +231,8 @@ struct ListView : sListView {
   auto setBackgroundColor(Color color = {}) { return self().setBackgroundColor(color), *this; }
   auto setBatchable(bool batchable = true) { return self().setBatchable(batchable), *this; }
   auto setForegroundColor(Color color = {}) { return self().setForegroundColor(color), *this; }
+  auto setItemCount(uint count) { return self().setItemCount(count), *this; }
+  auto updateItem(uint position) { return self().updateItem(position), *this; }
+  auto updateItems() { return self().updateItems(), *this; }
 };
 #endif
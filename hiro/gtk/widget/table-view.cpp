@@ -119,6 +119,18 @@ auto pTableView::resizeColumns() -> void {
   }
 }
 
+auto pTableView::selectAll() -> void {
+  auto lock = acquire();
+  gtk_tree_selection_select_all(gtkTreeSelection);
+  _updateSelected();
+}
+
+auto pTableView::selectNone() -> void {
+  auto lock = acquire();
+  gtk_tree_selection_unselect_all(gtkTreeSelection);
+  _updateSelected();
+}
+
 auto pTableView::setAlignment(Alignment alignment) -> void {
   _updateRulesHint();
 }
@@ -175,12 +187,52 @@ auto pTableView::setHeadered(bool headered) -> void {
   gtk_tree_view_set_headers_visible(gtkTreeView, headered);
 }
 
+//virtualized rows hold no data: the cell renderers are given each row's contents by _doDataFunc() as it is drawn
+auto pTableView::setItemCount(uint count) -> void {
+  auto lock = acquire();
+  dataRow.reset();
+  if(!gtkListStore) return;  //rows are added by _createModel() once the first column exists
+
+  uint rows = gtk_tree_model_iter_n_children(gtkTreeModel, nullptr);
+  if(rows < count) {
+    //detaching the model avoids updating the view once per row when filling a large list
+    bool detach = rows == 0;
+    if(detach) gtk_tree_view_set_model(gtkTreeView, nullptr);
+    GtkTreeIter iter;
+    while(rows < count) gtk_list_store_append(gtkListStore, &iter), rows++;
+    if(detach) gtk_tree_view_set_model(gtkTreeView, gtkTreeModel);
+  }
+  while(rows > count) {
+    GtkTreeIter iter;
+    if(!gtk_tree_model_iter_nth_child(gtkTreeModel, &iter, nullptr, rows - 1)) break;
+    gtk_list_store_remove(gtkListStore, &iter);
+    rows--;
+  }
+  _updateSelected();
+}
+
 auto pTableView::setSortable(bool sortable) -> void {
   for(auto& column : state().columns) {
     if(auto self = column->self()) gtk_tree_view_column_set_clickable(self->gtkColumn, sortable);
   }
 }
 
+auto pTableView::updateItem(uint position) -> void {
+  if(dataRow && dataRow() == position) dataRow.reset();
+  if(!gtkTreeModel) return;
+  GtkTreeIter iter;
+  if(gtk_tree_model_iter_nth_child(gtkTreeModel, &iter, nullptr, position)) {
+    GtkTreePath* path = gtk_tree_model_get_path(gtkTreeModel, &iter);
+    gtk_tree_model_row_changed(gtkTreeModel, path, &iter);
+    gtk_tree_path_free(path);
+  }
+}
+
+auto pTableView::updateItems() -> void {
+  dataRow.reset();
+  gtk_widget_queue_draw(gtkWidgetChild);
+}
+
 auto pTableView::_cellWidth(uint _row, uint _column) -> uint {
   uint width = 8;
   if(auto item = self().item(_row)) {
@@ -235,6 +287,10 @@ auto pTableView::_createModel() -> void {
 
   gtkListStore = gtk_list_store_newv(types.size(), types.data());
   gtkTreeModel = GTK_TREE_MODEL(gtkListStore);
+  if(state().virtualized) {
+    GtkTreeIter iter;
+    for(uint row : range(state().itemCount)) gtk_list_store_append(gtkListStore, &iter);
+  }
   gtk_tree_view_set_model(gtkTreeView, gtkTreeModel);
 }
 
@@ -272,6 +328,7 @@ auto pTableView::_doDataFunc(GtkTreeViewColumn* gtkColumn, GtkCellRenderer* rend
   auto path = gtk_tree_model_get_string_from_iter(gtkTreeModel, iter);
   auto row = toNatural(path);
   g_free(path);
+  if(row >= self().itemCount()) return;
 
   for(auto& column : state().columns) {
     if(auto p = column->self()) {
@@ -279,8 +336,20 @@ auto pTableView::_doDataFunc(GtkTreeViewColumn* gtkColumn, GtkCellRenderer* rend
       && renderer != GTK_CELL_RENDERER(p->gtkCellIcon)
       && renderer != GTK_CELL_RENDERER(p->gtkCellText)
       ) continue;
-      if(auto item = self().item(row)) {
+      if(auto item = _item(row)) {
         if(auto cell = item->cell(column->offset())) {
+          if(state().virtualized) {
+            //the model holds no data for virtualized rows, so the renderer contents are set here
+            if(renderer == GTK_CELL_RENDERER(p->gtkCellToggle)) {
+              g_object_set(G_OBJECT(renderer), "active", (gboolean)cell->state.checked, nullptr);
+            } else if(renderer == GTK_CELL_RENDERER(p->gtkCellIcon)) {
+              auto pixbuf = CreatePixbuf(cell->state.icon);
+              g_object_set(G_OBJECT(renderer), "pixbuf", pixbuf, nullptr);
+              if(pixbuf) g_object_unref(pixbuf);
+            } else if(renderer == GTK_CELL_RENDERER(p->gtkCellText)) {
+              g_object_set(G_OBJECT(renderer), "text", cell->state.text.data(), nullptr);
+            }
+          }
           if(renderer == GTK_CELL_RENDERER(p->gtkCellToggle)) {
             gtk_cell_renderer_set_visible(renderer, cell->state.checkable);
           } else if(renderer == GTK_CELL_RENDERER(p->gtkCellText)) {
@@ -321,11 +390,13 @@ auto pTableView::_doEdit(GtkCellRendererText* gtkCellRendererText, const char* p
     if(auto delegate = column->self()) {
       if(gtkCellRendererText == GTK_CELL_RENDERER_TEXT(delegate->gtkCellText)) {
         auto row = toNatural(path);
-        if(auto item = self().item(row)) {
+        if(row >= self().itemCount()) return;
+        if(auto item = _item(row)) {
           if(auto cell = item->cell(column->offset())) {
             if(string{text} != cell->state.text) {
               cell->setText(text);
               if(!locked()) self().doEdit(cell);
+              if(state().virtualized) updateItem(row);
             }
             return;
           }
@@ -348,6 +419,7 @@ auto pTableView::_doEvent(GdkEventButton* gdkEvent) -> int {
       if(gtk_tree_selection_count_selected_rows(gtkTreeSelection) > 0) {
         gtk_tree_selection_unselect_all(gtkTreeSelection);
         for(auto& item : state().items) item->setSelected(false);
+        state().selection.reset();
         self().doChange();
         return true;
       }
@@ -421,16 +493,19 @@ auto pTableView::_doToggle(GtkCellRendererToggle* gtkCellRendererToggle, const c
     if(auto delegate = column->self()) {
       if(gtkCellRendererToggle == GTK_CELL_RENDERER_TOGGLE(delegate->gtkCellToggle)) {
         auto row = toNatural(path);
-        if(auto item = self().item(row)) {
+        if(row >= self().itemCount()) return;
+        if(auto item = _item(row)) {
           if(auto cell = item->cell(column->offset())) {
             //GTK+ sends the "toggled" signal *before* changing the currently selected item
             //if TableView::doToggle calls TableView::selected(), it will retrieve the old state instead
             //gtk_tree_selection_get_selected_rows() will also report incorrectly, so _updateSelected() cannot be used here
             //note: this hack here also works correctly in batchable (multi-selection) mode, so it seems safe in practice
             for(auto& item : state().items) item->state.selected = item->offset() == row;
+            if(state().virtualized) state().selection = {row};
 
             cell->setChecked(!cell->checked());
             if(!locked()) self().doToggle(cell);
+            if(state().virtualized) updateItem(row);
             return;
           }
         }
@@ -492,10 +567,11 @@ auto pTableView::_updateSelected() -> void {
   if(identical) return;
 
   currentSelection = selected;
+  if(state().virtualized) state().selection = selected;
   for(auto& item : state().items) item->state.selected = false;
   for(auto& position : currentSelection) {
-    if(position >= self().itemCount()) continue;
-    self().item(position)->state.selected = true;
+    if(position >= state().items.size()) continue;
+    state().items[position]->state.selected = true;
   }
 
   if(!locked()) self().doChange();
@@ -506,12 +582,48 @@ auto pTableView::_width(uint column) -> uint {
   uint width = 1;
   if(!self().column(column).visible()) return width;
   if(self().headered()) width = max(width, _columnWidth(column));
+  //measuring every virtualized row would request all of them: such columns should be expandable or sized explicitly
+  if(state().virtualized) return width;
   for(auto row : range(self().itemCount())) {
     width = max(width, _cellWidth(row, column));
   }
   return width;
 }
 
+//when virtualized, the most recently requested row is kept, as each row is requested once per cell renderer
+auto pTableView::_item(uint row) -> TableViewItem {
+  if(!state().virtualized) return self().item(row);
+  if(!dataRow || dataRow() != row) {
+    dataItem = self().item(row);
+    dataRow = row;
+  }
+  return dataItem;
+}
+
+//virtualized rows have no pTableViewItem: mTableViewItem::setFocused() and setSelected() forward here instead
+auto pTableView::_setItemFocused(uint row) -> void {
+  Application::processEvents();
+
+  auto lock = acquire();
+  GtkTreePath* path = gtk_tree_path_new_from_string(string{row});
+  gtk_tree_view_set_cursor(gtkTreeView, path, nullptr, false);
+  gtk_tree_view_scroll_to_cell(gtkTreeView, path, nullptr, true, 0.5, 0.0);
+  gtk_tree_path_free(path);
+}
+
+auto pTableView::_setItemSelected(uint row, bool selected) -> void {
+  auto lock = acquire();
+  GtkTreeIter iter;
+  if(gtk_tree_model_iter_nth_child(gtkTreeModel, &iter, nullptr, row)) {
+    if(selected) {
+      gtk_tree_selection_select_iter(gtkTreeSelection, &iter);
+    } else {
+      gtk_tree_selection_unselect_iter(gtkTreeSelection, &iter);
+    }
+  }
+  _updateSelected();
+}
+
 }
 
 #endif
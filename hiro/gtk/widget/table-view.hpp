@@ -11,6 +11,8 @@ struct pTableView : pWidget {
   auto remove(sTableViewColumn column) -> void;
   auto remove(sTableViewItem item) -> void;
   auto resizeColumns() -> void;
+  auto selectAll() -> void;
+  auto selectNone() -> void;
   auto setAlignment(Alignment alignment) -> void;
   auto setBackgroundColor(Color color) -> void;
   auto setBatchable(bool batchable) -> void;
@@ -20,7 +22,10 @@ struct pTableView : pWidget {
   auto setForegroundColor(Color color) -> void;
   auto setGeometry(Geometry geometry) -> void override;
   auto setHeadered(bool headered) -> void;
+  auto setItemCount(uint count) -> void;
   auto setSortable(bool sortable) -> void;
+  auto updateItem(uint position) -> void;
+  auto updateItems() -> void;
 
   auto _cellWidth(uint row, uint column) -> uint;
   auto _columnWidth(uint column) -> uint;
@@ -35,6 +40,9 @@ struct pTableView : pWidget {
   auto _doKeyPress(GdkEventKey* event) -> bool;
   auto _doMouseMove() -> int;
   auto _doToggle(GtkCellRendererToggle* gtkCellRendererToggle, const char* path) -> void;
+  auto _item(uint row) -> TableViewItem;
+  auto _setItemFocused(uint row) -> void;
+  auto _setItemSelected(uint row, bool selected) -> void;
   auto _updateRulesHint() -> void;
   auto _updateSelected() -> void;
   auto _width(uint column) -> uint;
@@ -48,6 +56,8 @@ struct pTableView : pWidget {
   GtkEntry* gtkEntry = nullptr;
   vector<uint> currentSelection;
   bool suppressChange = false;
+  maybe<uint> dataRow;  //row of dataItem, when virtualized
+  TableViewItem dataItem;
 };
 
 }
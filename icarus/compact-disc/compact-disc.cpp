@@ -20,21 +20,21 @@ auto CompactDisc::import(string filename) -> string {
   auto cdrom = vfs::cdrom::open(filename);
   if(!cdrom) return "failed to parse CUE sheet";
 
-  if(auto fp = file::open({location, "cd.rom"}, file::mode::write)) {
-    while(!cdrom->end()) fp.write(cdrom->read());
-  }
-
+  if(!Encode::CDZ::create({location, "cd.rom"}, *cdrom)) return "failed to write CD image";
   return {};
 }
 
 auto CompactDisc::readDataSectorBCD(string pathname, uint sectorID) -> vector<uint8_t> {
-  auto fp = file::open({pathname, "cd.rom"}, file::mode::read);
+  //images are compressed on import, but uncompressed images from earlier imports are still accepted
+  shared_pointer<vfs::file> fp = vfs::cdz::open({pathname, "cd.rom"});
+  if(!fp) fp = vfs::disk::open({pathname, "cd.rom"}, vfs::file::mode::read);
   if(!fp) return {};
 
   vector<uint8_t> toc;
   toc.resize(96 * 7500);
   for(uint sector : range(7500)) {
-    fp.read({toc.data() + 96 * sector, 96});
+    fp->seek(2448 * sector + 2352, vfs::file::index::absolute);
+    fp->read(toc.data() + 96 * sector, 96);
   }
   CD::Session session;
   session.decode(toc, 96);
@@ -45,8 +45,8 @@ auto CompactDisc::readDataSectorBCD(string pathname, uint sectorID) -> vector<ui
       if(auto index = track.index(1)) {
         vector<uint8_t> sector;
         sector.resize(2448);
-        fp.seek(2448 * (abs(session.leadIn.lba) + index->lba + sectorID) + 16);
-        fp.read({sector.data(), 2448});
+        fp->seek(2448 * (abs(session.leadIn.lba) + index->lba + sectorID) + 16, vfs::file::index::absolute);
+        fp->read(sector.data(), 2448);
         return sector;
       }
     }
@@ -2,6 +2,7 @@
 #include <nall/cd.hpp>
 #include <nall/decode/cue.hpp>
 #include <nall/decode/wav.hpp>
+#include <nall/encode/cdz.hpp>
 #include <nall/vfs.hpp>
 using namespace nall;
 
@@ -25,6 +25,10 @@ GameManager::GameManager(View* parent) : Panel(parent, Size{~0, ~0}) {
       gameImporter.import(system, files);
     }
   });
+  gameList.onData([&](auto item) {
+    item.setIcon(Icon::Emblem::Folder);
+    item.setText(games[item.offset()]);
+  });
 }
 
 auto GameManager::select(string system) -> void {
@@ -41,14 +45,12 @@ auto GameManager::select(string system) -> void {
 }
 
 auto GameManager::refresh() -> void {
-  gameList.reset();
-  if(!path) return;
-
-  for(auto& name : directory::folders(*path)) {
-    ListViewItem item{&gameList};
-    item.setIcon(Icon::Emblem::Folder);
-    item.setText(string{name}.trimRight("/", 1L));
+  games.reset();
+  if(path) {
+    for(auto& name : directory::folders(*path)) games.append(string{name}.trimRight("/", 1L));
   }
+  gameList.setItemCount(games.size()).updateItems();
+  if(!path) return;
 
   programWindow.show(*this);
   gameList.resizeColumn();
@@ -11,6 +11,7 @@ struct GameManager : Panel {
 
   string system;
   maybe<string&> path;
+  vector<string> games;
 };
 
 extern GameManager& gameManager;
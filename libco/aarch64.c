@@ -101,6 +101,15 @@ int co_serializable() {
   return 1;
 }
 
+int co_live(cothread_t handle, unsigned int size, unsigned int* context, unsigned int* stack) {
+  unsigned long offset = ((unsigned long*)handle)[0] - (unsigned long)handle;
+  unsigned int registers = 176;  /* sp, x19-x30, d8-d15 */
+  if(offset < registers || offset > size) return 0;
+  *context = registers;
+  *stack = offset;
+  return 1;
+}
+
 #ifdef __cplusplus
 }
 #endif
@@ -157,6 +157,19 @@ int co_serializable() {
   return 1;
 }
 
+int co_live(cothread_t handle, unsigned int size, unsigned int* context, unsigned int* stack) {
+  unsigned long long offset = (unsigned long long)((long long*)handle)[0] - (unsigned long long)handle;
+  #ifdef _WIN32
+  unsigned int registers = 240;  /* rsp, rbp, rsi, rdi, rbx, r12-r15, xmm6-xmm15 */
+  #else
+  unsigned int registers = 56;   /* rsp, rbp, rbx, r12-r15 */
+  #endif
+  if(offset < registers || offset > size) return 0;
+  *context = registers;
+  *stack = offset;
+  return 1;
+}
+
 #ifdef __cplusplus
 }
 #endif
@@ -77,6 +77,15 @@ int co_serializable() {
   return 1;
 }
 
+int co_live(cothread_t handle, unsigned int size, unsigned int* context, unsigned int* stack) {
+  unsigned long offset = ((unsigned long*)handle)[8] - (unsigned long)handle;
+  unsigned int registers = 40;  /* r4-r11, sp, lr */
+  if(offset < registers || offset > size) return 0;
+  *context = registers;
+  *stack = offset;
+  return 1;
+}
+
 #ifdef __cplusplus
 }
 #endif
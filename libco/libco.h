@@ -18,6 +18,7 @@ cothread_t co_create(unsigned int, void (*)(void));
 void co_delete(cothread_t);
 void co_switch(cothread_t);
 int co_serializable(void);
+int co_live(cothread_t, unsigned int, unsigned int*, unsigned int*);
 
 #ifdef __cplusplus
 }
@@ -273,6 +273,14 @@ int co_serializable() {
   return 1;
 }
 
+int co_live(cothread_t handle, unsigned int size, unsigned int* context, unsigned int* stack) {
+  uint64_t offset = ((struct ppc64_context*)handle)->gprs[1] - (uint64_t)handle;
+  if(offset < sizeof(struct ppc64_context) || offset > size) return 0;
+  *context = sizeof(struct ppc64_context);
+  *stack = offset;
+  return 1;
+}
+
 #ifdef __cplusplus
 }
 #endif
@@ -140,6 +140,10 @@ int co_serializable() {
   return 0;
 }
 
+int co_live(cothread_t handle, unsigned int size, unsigned int* context, unsigned int* stack) {
+  return 0;
+}
+
 #ifdef __cplusplus
 }
 #endif
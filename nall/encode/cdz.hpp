@@ -0,0 +1,99 @@
+#pragma once
+
+#include <nall/vfs/vfs.hpp>
+#include <nall/encode/lzsa.hpp>
+
+namespace nall::Encode {
+
+//creates a compressed CD image (see vfs::cdz) from a 2448-byte-per-sector image (see vfs::cdrom)
+struct CDZ {
+  using cdz = vfs::cdz;
+
+  static auto create(const string& filename, vfs::file& image) -> bool {
+    auto fp = file::open(filename, file::mode::write);
+    if(!fp) return false;
+
+    uint64_t size = image.size() / cdz::SectorSize * cdz::SectorSize;
+    uint64_t hunkSize = cdz::SectorSize * cdz::HunkSectors;
+    uint64_t hunks = (size + hunkSize - 1) / hunkSize;
+
+    fp.writel(cdz::Signature, 4);
+    fp.writel(cdz::HunkSectors, 4);
+    fp.writel(size, 8);
+    fp.writel(hunks, 8);
+    for(uint64_t n : range(hunks * cdz::EntrySize)) fp.write(0x00);
+
+    vector<cdz::Hunk> index;
+    vector<uint8_t> input;
+    image.seek(0);
+    for(uint64_t hunk : range(hunks)) {
+      uint sectors = min((uint64_t)cdz::HunkSectors, size / cdz::SectorSize - hunk * cdz::HunkSectors);
+      input.resize(cdz::SectorSize * sectors);
+      image.read(input.data(), input.size());
+
+      cdz::Hunk entry;
+      auto packed = pack(input, sectors, entry);
+      auto payload = compress(packed, entry);
+      entry.offset = fp.offset();
+      entry.size = payload.size();
+      fp.write(payload);
+      index.append(entry);
+    }
+
+    fp.seek(cdz::HeaderSize);
+    for(auto& entry : index) {
+      fp.writel(entry.offset, 8);
+      fp.writel(entry.size, 4);
+      fp.writel(entry.codec, 1);
+      fp.writel(entry.regenerated, 1);
+      fp.writel(0, 2);
+    }
+    return true;
+  }
+
+private:
+  //splits a hunk into its main and subchannel data, omitting the EDC and ECC of mode 1 sectors where they can be recomputed
+  static auto pack(array_view<uint8_t> input, uint sectors, cdz::Hunk& entry) -> vector<uint8_t> {
+    vector<uint8_t> output;
+    output.reserve(input.size());
+    entry.codec = cdz::Audio;
+    uint8_t sector[2352];
+    for(uint n : range(sectors)) {
+      auto source = input.data() + cdz::SectorSize * n;
+      if(!CD::Sync::verify({source, 2352})) {
+        for(uint byte : range(2352)) output.append(source[byte]);
+        continue;
+      }
+      entry.codec = cdz::LZSA;
+      memory::copy(sector, source, 2352);
+      cdz::regenerate({sector, 2352});
+      bool regenerated = memory::compare(sector, source, 2352) == 0;
+      if(regenerated) entry.regenerated |= 1 << n;
+      for(uint byte : range(regenerated ? 2064 : 2352)) output.append(source[byte]);
+    }
+    for(uint n : range(sectors)) {
+      auto source = input.data() + cdz::SectorSize * n + 2352;
+      for(uint byte : range(96)) output.append(source[byte]);
+    }
+    return output;
+  }
+
+  //hunks without any data sectors are treated as CD-DA; hunks that do not compress are stored as-is
+  static auto compress(const vector<uint8_t>& packed, cdz::Hunk& entry) -> vector<uint8_t> {
+    vector<uint8_t> payload;
+    if(entry.codec == cdz::Audio) {
+      uint mainSize = packed.size() / cdz::SectorSize * 2352;
+      auto residuals = cdz::predict({packed.data(), mainSize});
+      residuals.reserve(packed.size());
+      for(uint byte : range(mainSize, packed.size())) residuals.append(packed[byte]);
+      payload = Encode::LZSA(residuals);
+    } else {
+      payload = Encode::LZSA(packed);
+    }
+    if(payload.size() < packed.size()) return payload;
+    entry.codec = cdz::Stored;
+    return packed;
+  }
+};
+
+}
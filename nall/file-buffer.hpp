@@ -132,6 +132,17 @@ struct file_buffer {
     fflush(fileHandle);
   }
 
+  //flushes all buffered data, and then commits it to the storage device
+  auto sync() -> bool {
+    if(!fileHandle) return false;
+    flush();
+    #if defined(API_POSIX)
+    return fsync(fileno(fileHandle)) == 0;
+    #elif defined(API_WINDOWS)
+    return _commit(fileno(fileHandle)) == 0;
+    #endif
+  }
+
   auto seek(int64_t offset, uint index_ = index::absolute) -> void {
     if(!fileHandle) return;
     bufferFlush();
@@ -35,6 +35,15 @@ struct file : inode {
     return false;
   }
 
+  //atomically replaces targetname with sourcename: both must be on the same file system
+  static auto replace(const string& sourcename, const string& targetname) -> bool {
+    #if defined(PLATFORM_WINDOWS)
+    return MoveFileExW(utf16_t(sourcename), utf16_t(targetname), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH);
+    #else
+    return ::rename(sourcename, targetname) == 0;
+    #endif
+  }
+
   static auto truncate(const string& filename, uint64_t size) -> bool {
     #if defined(API_POSIX)
     return truncate(filename, size) == 0;
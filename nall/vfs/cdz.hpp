@@ -0,0 +1,253 @@
+#pragma once
+
+//compressed CD image
+//the 2448-byte sectors of a CD image (see vfs::cdrom) are grouped into hunks, each compressed independently and
+//located through an index, so that any sector can be read without decoding the rest of the image.
+//decoded hunks are kept in a cache that is shared by every open image, and which is safe to use from multiple threads:
+//hunks are copied into and out of the cache under its lock, so that no hunk is ever shared between threads.
+//images are created by Encode::CDZ.
+
+#include <nall/cd.hpp>
+#include <nall/file.hpp>
+#include <nall/string.hpp>
+#include <nall/decode/lzsa.hpp>
+
+namespace nall::vfs {
+
+struct cdz : file {
+  static constexpr uint32_t Signature = 0x315a4443;  //"CDZ1"
+  static constexpr uint SectorSize  = 2448;  //2352 bytes of main channel data, followed by 96 bytes of subchannel data
+  static constexpr uint HunkSectors = 8;
+  static constexpr uint HeaderSize  = 24;
+  static constexpr uint EntrySize   = 16;
+
+  enum Codec : uint8_t {
+    Stored,  //uncompressed
+    LZSA,    //LZ77 + Huffman: used for data sectors
+    Audio,   //LZSA of second-order prediction residuals: used for CD-DA sectors
+  };
+
+  //hunk layout before compression: the main channel data of each sector, followed by the subchannel data of each sector.
+  //the EDC and ECC of mode 1 sectors are omitted (and recomputed when decoding) when they match the sector contents.
+  struct Hunk {
+    uint64_t offset = 0;
+    uint32_t size = 0;
+     uint8_t codec = Stored;
+     uint8_t regenerated = 0;  //bit n set = sector n is stored without its EDC and ECC
+  };
+
+  static auto open(const string& location) -> shared_pointer<cdz> {
+    auto instance = shared_pointer<cdz>{new cdz};
+    if(instance->load(location)) return instance;
+    return {};
+  }
+
+  auto size() const -> uintmax override {
+    return _size;
+  }
+
+  auto offset() const -> uintmax override {
+    return _offset;
+  }
+
+  auto seek(intmax offset, index mode) -> void override {
+    if(mode == index::absolute) _offset = (uintmax)offset;
+    if(mode == index::relative) _offset += (intmax)offset;
+  }
+
+  auto read() -> uint8_t override {
+    if(_offset >= _size) return 0x00;
+    uint64_t hunkSize = SectorSize * HunkSectors;
+    auto& data = hunk(_offset / hunkSize);
+    return data[_offset++ % hunkSize];
+  }
+
+  using file::read;
+  auto read(void* vdata, uintmax bytes) -> void override {
+    auto data = (uint8_t*)vdata;
+    uint64_t hunkSize = SectorSize * HunkSectors;
+    while(bytes && _offset < _size) {
+      auto& source = hunk(_offset / hunkSize);
+      uint64_t offset = _offset % hunkSize;
+      uint64_t length = min(bytes, source.size() - offset);
+      memory::copy(data, source.data() + offset, length);
+      data += length, _offset += length, bytes -= length;
+    }
+    if(bytes) memory::fill(data, bytes);
+  }
+
+  auto write(uint8_t data) -> void override {
+    //compressed images are read-only
+  }
+
+  //recomputes the EDC and ECC of a mode 1 sector
+  static auto regenerate(array_span<uint8_t> sector) -> void {
+    memory::fill(sector.data() + 2064, 2352 - 2064);
+    CD::EDC::createMode1({sector.data(), 2352});
+    CD::RSPC::encodeMode1({sector.data(), 2352});
+  }
+
+  //the predictor operates on each channel of the 16-bit stereo samples; the residuals are stored as two byte planes.
+  static auto predict(array_view<uint8_t> input) -> vector<uint8_t> {
+    uint samples = input.size() / 2;
+    vector<uint8_t> output;
+    output.resize(samples * 2);
+    int16_t history[2][2] = {};
+    for(uint n : range(samples)) {
+      auto& h = history[n & 1];
+      int16_t sample = input[n * 2 + 0] | input[n * 2 + 1] << 8;
+      uint16_t residual = sample - (2 * h[0] - h[1]);
+      h[1] = h[0], h[0] = sample;
+      output[n] = residual;
+      output[samples + n] = residual >> 8;
+    }
+    return output;
+  }
+
+  static auto unpredict(array_span<uint8_t> output, array_view<uint8_t> input) -> void {
+    uint samples = input.size() / 2;
+    int16_t history[2][2] = {};
+    for(uint n : range(samples)) {
+      auto& h = history[n & 1];
+      uint16_t residual = input[n] | input[samples + n] << 8;
+      int16_t sample = residual + (2 * h[0] - h[1]);
+      h[1] = h[0], h[0] = sample;
+      output[n * 2 + 0] = sample;
+      output[n * 2 + 1] = sample >> 8;
+    }
+  }
+
+private:
+  //decoded hunks, keyed by image and hunk number, are shared by all instances
+  struct Cache {
+    static constexpr uint Capacity = 64;
+
+    struct Entry {
+      string image;
+      uint64_t hunk = 0;
+      uint64_t used = 0;
+      vector<uint8_t> data;
+    };
+
+    static auto instance() -> Cache& {
+      static Cache cache;
+      return cache;
+    }
+
+    auto find(const string& image, uint64_t hunk, vector<uint8_t>& data) -> bool {
+      std::lock_guard<std::mutex> guard(mutex);
+      for(auto& entry : entries) {
+        if(entry.hunk == hunk && entry.image == image) {
+          entry.used = ++tick;
+          data = entry.data;
+          return true;
+        }
+      }
+      return false;
+    }
+
+    auto insert(const string& image, uint64_t hunk, const vector<uint8_t>& data) -> void {
+      std::lock_guard<std::mutex> guard(mutex);
+      if(entries.size() < Capacity) {
+        entries.append({image, hunk, ++tick, data});
+        return;
+      }
+      auto victim = &entries[0];
+      for(auto& entry : entries) {
+        if(entry.used < victim->used) victim = &entry;
+      }
+      *victim = {image, hunk, ++tick, data};
+    }
+
+    std::mutex mutex;
+    vector<Entry> entries;
+    uint64_t tick = 0;
+  };
+
+  auto load(const string& location) -> bool {
+    if(!_fp.open(location, nall::file::mode::read)) return false;
+    if(_fp.size() < HeaderSize || _fp.readl<uint32_t>(4) != Signature) return false;
+    if(_fp.readl<uint32_t>(4) != HunkSectors) return false;
+    _size = _fp.readl<uint64_t>(8);
+    uint64_t hunks = _fp.readl<uint64_t>(8);
+    if(hunks != (_size + SectorSize * HunkSectors - 1) / (SectorSize * HunkSectors)) return false;
+    if(_fp.size() < HeaderSize + hunks * EntrySize) return false;
+
+    _hunks.resize(hunks);
+    for(auto& hunk : _hunks) {
+      hunk.offset = _fp.readl<uint64_t>(8);
+      hunk.size = _fp.readl<uint32_t>(4);
+      hunk.codec = _fp.readl<uint8_t>(1);
+      hunk.regenerated = _fp.readl<uint8_t>(1);
+      _fp.readl<uint16_t>(2);
+      if(hunk.offset + hunk.size > _fp.size()) return false;
+    }
+
+    //the modification time distinguishes a replaced image from the cached hunks of its predecessor
+    _image = {location, ":", nall::file::timestamp(location, nall::file::time::modify)};
+    return true;
+  }
+
+  auto hunk(uint64_t index) -> const vector<uint8_t>& {
+    if(_data && _dataHunk == index) return _data;
+    auto& cache = Cache::instance();
+    if(!cache.find(_image, index, _data)) {
+      _data = decode(index);
+      cache.insert(_image, index, _data);
+    }
+    _dataHunk = index;
+    return _data;
+  }
+
+  auto decode(uint64_t index) -> vector<uint8_t> {
+    auto& hunk = _hunks[index];
+    uint64_t first = index * HunkSectors;
+    uint sectors = min((uint64_t)HunkSectors, _size / SectorSize - first);
+
+    vector<uint8_t> payload;
+    payload.resize(hunk.size);
+    _fp.seek(hunk.offset);
+    _fp.read({payload.data(), payload.size()});
+
+    vector<uint8_t> packed;
+    if(hunk.codec == Stored) packed = move(payload);
+    if(hunk.codec == LZSA || hunk.codec == Audio) packed = Decode::LZSA(payload);
+
+    uint mainSize = 0;
+    for(uint sector : range(sectors)) mainSize += hunk.regenerated >> sector & 1 ? 2064 : 2352;
+
+    vector<uint8_t> output;
+    output.resize(SectorSize * sectors);
+    if(packed.size() != mainSize + 96 * sectors) return output;  //corrupt hunk: return silence
+
+    vector<uint8_t> main;
+    if(hunk.codec == Audio) {
+      main.resize(mainSize);
+      unpredict(main, {packed.data(), mainSize});
+    }
+    auto source = hunk.codec == Audio ? main.data() : packed.data();
+    for(uint sector : range(sectors)) {
+      auto target = output.data() + SectorSize * sector;
+      if(hunk.regenerated >> sector & 1) {
+        memory::copy(target, source, 2064);
+        regenerate({target, 2352});
+        source += 2064;
+      } else {
+        memory::copy(target, source, 2352);
+        source += 2352;
+      }
+      memory::copy(target + 2352, packed.data() + mainSize + 96 * sector, 96);
+    }
+    return output;
+  }
+
+  nall::file_buffer _fp;
+  string _image;
+  uint64_t _size = 0;
+  vector<Hunk> _hunks;
+  uintmax _offset = 0;
+  vector<uint8_t> _data;  //the most recently accessed hunk
+  uint64_t _dataHunk = 0;
+};
+
+}
@@ -11,6 +11,10 @@ struct disk : file {
     return instance;
   }
 
+  auto location() const -> string override {
+    return _location;
+  }
+
   auto size() const -> uintmax override {
     return _fp.size();
   }
@@ -31,6 +35,16 @@ struct disk : file {
     _fp.write(data_);
   }
 
+  using file::read;
+  auto read(void* data_, uintmax bytes_) -> void override {
+    _fp.read({(uint8_t*)data_, (uint64_t)bytes_});
+  }
+
+  using file::write;
+  auto write(const void* data_, uintmax bytes_) -> void override {
+    _fp.write({(const uint8_t*)data_, (uint64_t)bytes_});
+  }
+
   auto flush() -> void override {
     _fp.flush();
   }
@@ -42,10 +56,12 @@ private:
 
   auto _open(string location_, mode mode_) -> bool {
     if(!_fp.open(location_, (uint)mode_)) return false;
+    _location = location_;
     return true;
   }
 
   file_buffer _fp;
+  string _location;
 };
 
 }
@@ -48,6 +48,21 @@ struct memory : file {
     _data[_offset++] = data;
   }
 
+  using file::read;
+  auto read(void* data, uintmax bytes) -> void override {
+    uintmax length = _offset < _size ? min(bytes, _size - _offset) : 0;
+    nall::memory::copy(data, _data + _offset, length);
+    nall::memory::fill((uint8_t*)data + length, bytes - length);
+    _offset += length;
+  }
+
+  using file::write;
+  auto write(const void* data, uintmax bytes) -> void override {
+    uintmax length = _offset < _size ? min(bytes, _size - _offset) : 0;
+    nall::memory::copy(_data + _offset, data, length);
+    _offset += length;
+  }
+
 private:
   memory() = default;
   memory(const file&) = delete;
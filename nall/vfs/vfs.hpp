@@ -11,6 +11,7 @@ struct file {
 
   virtual ~file() = default;
 
+  virtual auto location() const -> string { return {}; }  //path on disk, if any
   virtual auto size() const -> uintmax = 0;
   virtual auto offset() const -> uintmax = 0;
 
@@ -23,7 +24,7 @@ struct file {
     return offset() >= size();
   }
 
-  auto read(void* vdata, uintmax bytes) -> void {
+  virtual auto read(void* vdata, uintmax bytes) -> void {
     auto data = (uint8_t*)vdata;
     while(bytes--) *data++ = read();
   }
@@ -47,7 +48,7 @@ struct file {
     return s;
   }
 
-  auto write(const void* vdata, uintmax bytes) -> void {
+  virtual auto write(const void* vdata, uintmax bytes) -> void {
     auto data = (const uint8_t*)vdata;
     while(bytes--) write(*data++);
   }
@@ -68,5 +69,6 @@ struct file {
 }
 
 #include <nall/vfs/cdrom.hpp>
+#include <nall/vfs/cdz.hpp>
 #include <nall/vfs/disk.hpp>
 #include <nall/vfs/memory.hpp>
@@ -5,8 +5,15 @@
 
 //Linear interpolation is only applied horizontally for performance reasons, although Nearest is still much faster
 
+//Scaling uses a precomputed fixed-point column map; output rows that map to the same source row are copied
+//rather than scaled again, and large outputs are split into bands of rows that are scaled by a pool of threads
+
 #include <sys/shm.h>
+#include <unistd.h>
 #include <X11/extensions/XShm.h>
+#include <condition_variable>
+#include <mutex>
+#include <nall/thread.hpp>
 
 struct VideoXShm : VideoDriver {
   VideoXShm& self = *this;
@@ -101,17 +108,10 @@ struct VideoXShm : VideoDriver {
     if(!width) width = viewportWidth;
     if(!height) height = viewportHeight;
 
-    float xratio = (float)_inputWidth / (float)width;
-    float yratio = (float)_inputHeight / (float)height;
-
     int x = ((int)viewportWidth - (int)width) / 2;
     int y = ((int)viewportHeight - (int)height) / 2;
 
-    width = min(width, viewportWidth);
-    height = min(height, viewportHeight);
-
     auto inputBuffer = _inputBuffer;
-    auto outputBuffer = _outputBuffer;
 
     if(x < 0) {
       inputBuffer += abs(x);
@@ -126,25 +126,60 @@ struct VideoXShm : VideoDriver {
     x += viewportX;
     y += viewportY;
 
-    #pragma omp parallel for
-    for(uint y = 0; y < height; y++) {
-      float ystep = y * yratio;
-      float xstep = 0;
+    if(_mapWidth != width || _mapInputWidth != _inputWidth) {
+      _mapWidth = width;
+      _mapInputWidth = _inputWidth;
+      _columns.resize(width);
+      _weights.resize(width);
+      uint64_t step = ((uint64_t)_inputWidth << 16) / width;
+      for(uint x : range(width)) {
+        uint64_t position = x * step;
+        _columns[x] = position >> 16;
+        _weights[x] = position >> 8 & 0xff;
+      }
+    }
 
-      uint32_t* sp = inputBuffer + (uint)ystep * _inputWidth;
-      uint32_t* dp = outputBuffer + y * _outputWidth;
+    //pixels are replicated rather than looked up when the output is an exact multiple of the input
+    uint factor = width % _inputWidth == 0 ? width / _inputWidth : 0;
+    bool blur = self.shader == "Blur";
+    uint scaledHeight = height;
 
-      if(self.shader != "Blur") {
-        for(uint x = 0; x < width; x++) {
-          *dp++ = 255u << 24 | sp[(uint)xstep];
-          xstep += xratio;
-        }
-      } else {
-        for(uint x = 0; x < width; x++) {
-          *dp++ = 255u << 24 | interpolate(xstep - (uint)xstep, sp[(uint)xstep], sp[(uint)xstep + 1]);
-          xstep += xratio;
+    width = min(width, viewportWidth);
+    height = min(height, viewportHeight);
+
+    auto scale = [&](uint first, uint last) -> void {
+      uint previous = ~0u;
+      for(uint y = first; y < last; y++) {
+        uint row = (uint64_t)y * _inputHeight / scaledHeight;
+        uint32_t* sp = inputBuffer + row * _inputWidth;
+        uint32_t* dp = _outputBuffer + y * _outputWidth;
+
+        if(row == previous) {
+          memory::copy<uint32_t>(dp, dp - _outputWidth, width);
+        } else if(blur) {
+          for(uint x = 0; x < width; x++) {
+            uint column = _columns[x];
+            dp[x] = 255u << 24 | interpolate(_weights[x], sp[column], sp[column + 1]);
+          }
+        } else if(factor) {
+          for(uint x = 0, column = 0; x < width; column++) {
+            uint32_t pixel = 255u << 24 | sp[column];
+            for(uint n = 0; n < factor && x < width; n++) dp[x++] = pixel;
+          }
+        } else {
+          for(uint x = 0; x < width; x++) {
+            dp[x] = 255u << 24 | sp[_columns[x]];
+          }
         }
+        previous = row;
       }
+    };
+
+    //small outputs are not worth waking the worker threads for
+    if(width * height < 512 * 512) {
+      scale(0, height);
+    } else {
+      parallel(height, scale);
     }
 
     GC gc = XCreateGC(_display, _window, 0, 0);
@@ -173,10 +208,61 @@ private:
   }
 
   auto destruct() -> void {
+    if(_workers) {
+      _lock.lock();
+      _running = false;
+      _lock.unlock();
+      _wake.notify_all();
+      for(auto& worker : _workers) worker.join();
+      _workers.reset();
+    }
     terminate();
     XCloseDisplay(_display);
   }
 
+  //splits rows [0, height) into one band per core, scaling the first band on the calling thread
+  auto parallel(uint height, const function<void (uint, uint)>& job) -> void {
+    if(!_workers) {
+      uint cores = max(1, (int)sysconf(_SC_NPROCESSORS_ONLN));
+      _bands = min(cores, 8u);
+      _running = true;
+      for(uint band : range(1, _bands)) {
+        _workers.append(nall::thread::create([&](uintptr band) { worker(band); }, band));
+      }
+    }
+
+    auto band = [&](uint index) -> void {
+      job(height * index / _bands, height * (index + 1) / _bands);
+    };
+
+    std::unique_lock<std::mutex> lock(_lock);
+    _job = band;
+    _pending = _bands - 1;
+    _generation++;
+    lock.unlock();
+    _wake.notify_all();
+
+    band(0);
+
+    lock.lock();
+    _done.wait(lock, [&] { return _pending == 0; });
+    _job.reset();
+  }
+
+  auto worker(uint band) -> void {
+    uint generation = 0;
+    std::unique_lock<std::mutex> lock(_lock);
+    while(true) {
+      _wake.wait(lock, [&] { return !_running || _generation != generation; });
+      if(!_running) return;
+      generation = _generation;
+      lock.unlock();
+      _job(band);
+      lock.lock();
+      if(--_pending == 0) _done.notify_one();
+    }
+  }
+
   auto initialize() -> bool {
     terminate();
     if(!self.fullScreen && !self.context) return false;
@@ -265,13 +351,11 @@ private:
     _outputBuffer = nullptr;
   }
 
-  alwaysinline auto interpolate(float mu, uint32_t a, uint32_t b) -> uint32_t {
-    uint8_t ar = a >> 16, ag = a >> 8, ab = a >> 0;
-    uint8_t br = b >> 16, bg = b >> 8, bb = b >> 0;
-    uint8_t cr = ar * (1.0 - mu) + br * mu;
-    uint8_t cg = ag * (1.0 - mu) + bg * mu;
-    uint8_t cb = ab * (1.0 - mu) + bb * mu;
-    return cr << 16 | cg << 8 | cb << 0;
+  //weight is in 1/256ths; red and blue are blended together with a single multiply each
+  alwaysinline auto interpolate(uint weight, uint32_t a, uint32_t b) -> uint32_t {
+    uint32_t rb = (a & 0xff00ff) * (256 - weight) + (b & 0xff00ff) * weight >> 8 & 0xff00ff;
+    uint32_t g  = (a & 0x00ff00) * (256 - weight) + (b & 0x00ff00) * weight >> 8 & 0x00ff00;
+    return rb | g;
   }
 
   static auto errorHandler(Display* display, XErrorEvent* event) -> int {
@@ -304,4 +388,19 @@ private:
   uint32_t* _outputBuffer = nullptr;
   uint _outputWidth = 0;
   uint _outputHeight = 0;
+
+  vector<uint> _columns;  //source column of each output column
+  vector<uint> _weights;  //blend weight of the following source column, in 1/256ths
+  uint _mapWidth = 0;
+  uint _mapInputWidth = 0;
+
+  vector<nall::thread> _workers;
+  uint _bands = 1;
+  std::mutex _lock;
+  std::condition_variable _wake;
+  std::condition_variable _done;
+  function<void (uint)> _job;
+  uint _generation = 0;
+  uint _pending = 0;
+  bool _running = false;
 };